@@ -265,6 +265,7 @@
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -682,6 +683,7 @@
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -951,6 +953,7 @@
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -1196,6 +1199,7 @@
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -136,6 +136,27 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** EXPERIMENTAL API - Subject to change
+
+    Batched variant of grpc_completion_queue_next: dequeues up to \a
+    max_events completed events into \a events with a single blocking wait,
+    amortizing the per-call polling work over the batch.
+
+    Blocks (up to \a deadline) only until the first event is available; once
+    one event has been dequeued, additional already-completed events are
+    collected without further blocking. Returns the number of events written.
+    A GRPC_QUEUE_SHUTDOWN or GRPC_QUEUE_TIMEOUT event is only ever written to
+    events[0] (i.e when nothing else was dequeued; the return value is 1).
+
+    \a max_events must be greater than zero. Only valid on completion queues
+    of type GRPC_CQ_NEXT. The same caveats as grpc_completion_queue_next
+    apply. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -172,6 +193,16 @@ GRPCAPI void grpc_completion_queue_destroy(grpc_completion_queue* cq);
 /** Initializes a thread local cache for \a cq.
  * grpc_flush_cq_tls_cache() MUST be called on the same thread,
  * with the same cq.
+ *
+ * This is the "inline completion" fast path for thread-per-connection style
+ * event loops: while the cache is armed on the polling thread, a completion
+ * that finishes on that thread is stored directly in the thread-local slot -
+ * bypassing the cq's event queue and the pollset kick entirely (no futex
+ * wake) - and is returned by grpc_completion_queue_thread_local_cache_flush.
+ * Completions that land on other threads still take the normal queue; note
+ * also that the event queue kick is only issued for the first pending event
+ * and is suppressed by the polling engines when the kicking thread is
+ * already the active poller of that pollset.
  */
 GRPCAPI void grpc_completion_queue_thread_local_cache_init(
     grpc_completion_queue* cq);
@@ -487,6 +518,18 @@ GRPCAPI void grpc_resource_quota_resize(grpc_resource_quota* resource_quota,
 GRPCAPI void grpc_resource_quota_set_max_threads(
     grpc_resource_quota* resource_quota, int new_max_threads);
 
+/** EXPERIMENTAL.  Register a trim callback on a buffer pool.  When the pool
+    has exhausted both its benign and destructive reclaimers and memory
+    demand remains, \a trim is invoked (with \a user_data) so the
+    application can release memory held outside the pool's accounting -
+    allocator arenas (e.g. malloc_trim), application-level caches, and the
+    like.  The callback runs at most once per reclamation cycle, outside
+    any gRPC lock, on a gRPC-internal thread.  Pass a NULL \a trim to
+    clear a previously registered callback. */
+GRPCAPI void grpc_resource_quota_set_trim_callback(
+    grpc_resource_quota* resource_quota, void (*trim)(void* user_data),
+    void* user_data);
+
 /** Fetch a vtable for a grpc_channel_arg that points to a grpc_resource_quota
  */
 GRPCAPI const grpc_arg_pointer_vtable* grpc_resource_quota_arg_vtable(void);
@@ -556,6 +556,19 @@ GRPCAPI grpc_server_credentials*
 grpc_ssl_server_credentials_create_with_options(
     grpc_ssl_server_credentials_options* options);
 
+/** EXPERIMENTAL API - Subject to change.
+    Sets the TLS session ticket encryption key on SSL server credentials, in
+    the format expected by the SSL stack's ticket key API (48 bytes of key
+    material for BoringSSL/OpenSSL: 16 byte key name, 16 byte AES key, 16
+    byte HMAC key). Servers sharing the same key (e.g. across a fleet, or
+    across restarts during a deploy) can resume each other's TLS sessions
+    with abbreviated handshakes instead of full asymmetric handshakes.
+    The key bytes are copied; callers should scrub their copy. Must be
+    called before the credentials are used by a server. Rotate by deploying
+    a new key fleet-wide. */
+GRPCAPI void grpc_ssl_server_credentials_set_session_ticket_key(
+    grpc_server_credentials* creds, const char* key, size_t key_size);
+
 /** --- Server-side secure ports. --- */
 
 /** Add a HTTP2 over an encrypted link over tcp listener.
@@ -45,7 +45,10 @@ GRPCAPI grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
 
 /** Copies input byte buffer \a bb.
  *
- * Increases the reference count of all the source slices. The user is
+ * This is a shallow copy: it increases the reference count of all the source
+ * slices and never copies payload bytes, so the cost is one fixed-size
+ * buffer shell plus one atomic increment per slice (proxy workloads can
+ * forward messages hop-to-hop with it at zero payload cost). The user is
  * responsible for calling grpc_byte_buffer_destroy over the returned copy. */
 GRPCAPI grpc_byte_buffer* grpc_byte_buffer_copy(grpc_byte_buffer* bb);
 
@@ -86,6 +89,21 @@ GRPCAPI int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
 GRPCAPI int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                          grpc_slice** slice);
 
+/** EXPERIMENTAL API - This function may be removed and changed, in the future.
+ *
+ * Exposes every remaining piece of data in \a reader as one contiguous array
+ * of \a *slice_count slices starting at \a *slices, consuming the reader in a
+ * single call (useful e.g. to build an iovec view of a whole message), and
+ * returns 1. Returns 0 (with an empty view) if the buffer type holds no
+ * slice array. No slice refs are taken.
+ *
+ * NOTE: The same lifetime caveats as grpc_byte_buffer_reader_peek apply: the
+ *       view is only valid while the underlying grpc_byte_buffer is alive
+ *       and immutable. */
+GRPCAPI int grpc_byte_buffer_reader_peek_all(grpc_byte_buffer_reader* reader,
+                                             grpc_slice** slices,
+                                             size_t* slice_count);
+
 /** Merge all data from \a reader into single slice */
 GRPCAPI grpc_slice
 grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader);
@@ -34,6 +34,18 @@ extern "C" {
  *
  * \addtogroup grpc_arg_keys
  * \{ */
+/** (Integer, bytes) Messages at least this large are compressed on an
+    executor thread instead of inline on the call combiner, so very large
+    sends do not stall other work on the call. 0 (the default) compresses
+    inline. */
+#define GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.experimental.compression_offload_threshold"
+/** If non-zero, large outgoing messages are probed (a small sample is
+    deflated) and compression is skipped entirely when the payload looks
+    incompressible, avoiding wasted CPU on already-compressed blobs in
+    mixed traffic. Defaults to off. */
+#define GRPC_ARG_ADAPTIVE_COMPRESSION \
+  "grpc.experimental.adaptive_compression"
 /** Default compression algorithm for the channel.
  * Its value is an int from the \a grpc_compression_algorithm enum. */
 #define GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM \
@@ -219,6 +219,45 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How many bytes to aim to hand the endpoint per write (and hence per
+    syscall). If unset or 0, the transport adapts the value between writes.
+    Setting it pins the write size. */
+#define GRPC_ARG_HTTP2_TARGET_WRITE_SIZE \
+  "grpc.experimental.http2.target_write_size"
+/** If non-zero, the server defers per-connection session setup (handshake
+    manager construction and kickoff) from the acceptor thread to the
+    executor, so accept() keeps draining the listen backlog during
+    reconnect storms. Defaults to off. */
+#define GRPC_ARG_SERVER_ACCEPT_OFFLOAD \
+  "grpc.experimental.server_accept_offload"
+/** If non-zero, a server dynamically shrinks its advertised
+    MAX_CONCURRENT_STREAMS below the configured value while the resource
+    quota reports high memory pressure (linear from the full value at 80%
+    pressure down to 1/16 at 95%), restoring it as pressure subsides, so
+    overload sheds new streams to other connections instead of queueing
+    them behind work the server cannot schedule. Only meaningful when
+    GRPC_ARG_MAX_CONCURRENT_STREAMS is also configured (scaling an unlimited
+    advertisement has no effect). Defaults to off. */
+#define GRPC_ARG_ADAPTIVE_MAX_CONCURRENT_STREAMS \
+  "grpc.experimental.adaptive_max_concurrent_streams"
+/** If non-zero, couple per-stream receive windows to the BDP-tuned transport
+    target: a stream whose reader is actively consuming is granted a window
+    commensurate with the measured bandwidth-delay product immediately,
+    instead of ramping up via per-read lookahead hints. Helps large streams
+    resuming behind many small ones. Defaults to off. */
+#define GRPC_ARG_HTTP2_STREAM_BDP_BURST \
+  "grpc.experimental.http2.stream_bdp_burst"
+/** Maximum number of DATA bytes a single stream may contribute to one write
+    before the write scheduler rotates to the next writable stream. 0 (the
+    default) means no per-stream bound. */
+#define GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM \
+  "grpc.experimental.http2.stream_write_quantum"
+/** Comma-separated list of header keys that the HPACK encoder must never add
+    to the dynamic table. Useful when a channel multiplexes traffic classes:
+    marking the bulk class's one-off headers never-index keeps them from
+    evicting valuable repeated headers (e.g. a large auth token). */
+#define GRPC_ARG_HTTP2_HPACK_NEVER_INDEX_KEYS \
+  "grpc.experimental.http2.hpack_never_index_keys"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -323,6 +362,58 @@ typedef struct {
   "grpc.experimental.tcp_min_read_chunk_size"
 #define GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE \
   "grpc.experimental.tcp_max_read_chunk_size"
+/** (Integer, milliseconds) If set, c-ares DNS resolution results are kept in
+    a process-wide cache shared across channels for this long. Fresh entries
+    resolve synchronously; entries past half their TTL are served stale while
+    a background refresh runs (stale-while-revalidate). 0 (the default)
+    disables caching. */
+#define GRPC_ARG_DNS_CACHE_TTL_MS "grpc.experimental.dns_cache_ttl_ms"
+/** If non-zero, pick_first eagerly connects every resolved subchannel (not
+    just the one being tried), pre-staging TCP connections and handshakes so
+    failover lands on a warm connection. Costs one idle connection per
+    backup address. Defaults to off. */
+#define GRPC_ARG_EAGER_SUBCHANNEL_CONNECT \
+  "grpc.experimental.eager_subchannel_connect"
+/** (String) Name of a request metadata key used for affinity-based picking:
+    when set, calls carrying that key are routed by hashing its value over
+    the READY backends, so equal keys consistently reach the same backend
+    while the backend set is stable. Calls without the key round-robin as
+    usual. */
+#define GRPC_ARG_AFFINITY_HASH_KEY "grpc.experimental.affinity_hash_key"
+/** (String) Locality label (e.g. a zone name) of this client, used by
+    locality-aware load balancing policies: when set, round_robin restricts
+    picks to READY backends whose GRPC_ARG_ADDRESS_LOCALITY matches, and
+    spills over to all backends when no local one is READY. */
+#define GRPC_ARG_LOCALITY "grpc.experimental.locality"
+/** (String) Per-address locality label attached by resolvers; see
+    GRPC_ARG_LOCALITY. */
+#define GRPC_ARG_ADDRESS_LOCALITY "grpc.experimental.address_locality"
+/** (Integer) Per-address relative load balancing weight, attached by
+    resolvers to individual addresses. Weight-aware policies (round_robin)
+    direct proportionally more picks at higher-weight addresses. Defaults
+    to 1; capped at 128. */
+#define GRPC_ARG_ADDRESS_WEIGHT "grpc.experimental.address_weight"
+/** (Integer) Number of parallel connections (subchannels) to maintain per
+    resolved address. Each address is expanded into this many distinctly
+    keyed subchannels, so stream-distributing load balancing policies (e.g.
+    round_robin) spread streams over multiple connections to the same
+    backend instead of hitting MAX_CONCURRENT_STREAMS head-of-line blocking.
+    Defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_STRIPES "grpc.experimental.subchannel_stripes"
+/* (Integer, bytes) Pre-size the per-call arena: sets a floor for the
+   channel's adaptive call size estimate. Calls whose state fits in the floor
+   never take the arena growth (malloc) path, at the cost of the floor being
+   allocated up front for every call on the channel. */
+#define GRPC_ARG_MIN_CALL_SIZE_ESTIMATE \
+  "grpc.experimental.min_call_size_estimate"
+/* TCP TX Zerocopy enable state: zero is disabled, non-zero is enabled. By
+   default, it is disabled. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_tx_zero_copy_enabled"
+/* TCP TX Zerocopy send threshold: only zerocopy if >= this many bytes sent. By
+   default, this is 16KB. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_tx_zero_copy_send_bytes_threshold"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -472,6 +563,13 @@ typedef enum grpc_call_error {
 #define GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET (0x00000080u)
 /** Signal that the initial metadata should be corked */
 #define GRPC_INITIAL_METADATA_CORKED (0x00000100u)
+/** Signal that this call is latency critical: the HTTP/2 write scheduler
+    serves its frames ahead of ordinary streams on the same connection, so
+    small control RPCs are not queued behind bulk transfers. Intended for
+    small, sparse RPCs: multiple latency-critical streams with sustained
+    payloads contend with each other in most-recent-first order, so marking
+    bulk traffic latency-critical defeats the scheme. */
+#define GRPC_INITIAL_METADATA_LATENCY_CRITICAL (0x00000200u)
 
 /** Mask of all valid flags */
 #define GRPC_INITIAL_METADATA_USED_MASK                  \
@@ -479,7 +577,8 @@ typedef enum grpc_call_error {
    GRPC_INITIAL_METADATA_WAIT_FOR_READY |                \
    GRPC_INITIAL_METADATA_CACHEABLE_REQUEST |             \
    GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET | \
-   GRPC_INITIAL_METADATA_CORKED | GRPC_WRITE_THROUGH)
+   GRPC_INITIAL_METADATA_CORKED | GRPC_INITIAL_METADATA_LATENCY_CRITICAL | \
+   GRPC_WRITE_THROUGH)
 
 /** A single metadata element */
 typedef struct grpc_metadata {
@@ -731,9 +830,9 @@ typedef struct grpc_experimental_completion_queue_functor {
   struct grpc_experimental_completion_queue_functor* internal_next;
 } grpc_experimental_completion_queue_functor;
 
-/* The upgrade to version 2 is currently experimental. */
+/* The upgrades to versions 2 and 3 are currently experimental. */
 
-#define GRPC_CQ_CURRENT_VERSION 2
+#define GRPC_CQ_CURRENT_VERSION 3
 #define GRPC_CQ_VERSION_MINIMUM_FOR_CALLBACKABLE 2
 typedef struct grpc_completion_queue_attributes {
   /** The version number of this structure. More fields might be added to this
@@ -752,6 +851,17 @@ typedef struct grpc_completion_queue_attributes {
   grpc_experimental_completion_queue_functor* cq_shutdown_cb;
 
   /* END OF VERSION 2 CQ ATTRIBUTES */
+
+  /* EXPERIMENTAL: START OF VERSION 3 CQ ATTRIBUTES */
+  /** If non-NULL, the new completion queue does not create a pollset of its
+     own: it polls the named queue's pollset, so a group of queues shares
+     one epoll set while keeping independent event queues. The donor must
+     itself own a pollset (it cannot be another borrower or non-polling),
+     and borrowers must be shut down before the donor. The new queue holds
+     a reference on the donor until it is destroyed. */
+  grpc_completion_queue* cq_shared_pollset_donor;
+
+  /* END OF VERSION 3 CQ ATTRIBUTES */
 } grpc_completion_queue_attributes;
 
 /** The completion queue factory structure is opaque to the callers of grpc */
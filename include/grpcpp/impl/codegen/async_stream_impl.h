@@ -95,6 +95,20 @@ class AsyncReaderInterface {
   ///
   /// Side effect: note that this method attempt to receive initial metadata for
   /// a stream if it hasn't yet been received.
+  ///
+  /// Read-ahead note (re: keeping N reads in flight internally so fast
+  /// consumers skip a completion-queue round trip per message): the
+  /// one-outstanding-read contract is load-bearing at two levels. The core
+  /// call permits a single recv_message batch in flight per call, so depth
+  /// would have to be built by chaining - starting the next internal read
+  /// from inside the previous one's completion - and that completion is
+  /// delivered under the app's tag, leaving the library no tag of its own
+  /// to run internal ops on without intercepting the queue the app is
+  /// draining. Pipelining therefore belongs either below (the transport
+  /// already reads and buffers frames ahead under flow control; the
+  /// per-message cost is the cq wakeup, which GRPC_CQ_SPIN_ITERATIONS
+  /// addresses directly for sub-microsecond consumers) or in a redesigned
+  /// read API that owns its tags, not as a depth parameter here.
   virtual void Read(R* msg, void* tag) = 0;
 };
 
@@ -67,6 +67,13 @@ class ClientAsyncResponseReaderInterface {
 
 namespace internal {
 template <class R>
+/// Allocation note: readers (and the CallOpSets embedded in them) are
+/// placement-new'd into the call's arena - `operator new` is deliberately
+/// disabled on the reader types - so "reader object churn" is arena churn,
+/// not heap churn. The arena itself is obtained in one allocation sized by
+/// the channel's adaptive estimate and, since the per-channel arena
+/// recycling cache, is reused across consecutive calls; a separate
+/// per-channel reader pool would duplicate that cache one layer up.
 class ClientAsyncResponseReaderFactory {
  public:
   /// Start a call and write the request out if \a start is set.
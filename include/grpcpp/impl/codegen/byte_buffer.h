@@ -95,12 +95,38 @@ class ByteBuffer final {
         reinterpret_cast<grpc_slice*>(const_cast<Slice*>(slices)), nslices);
   }
 
+  /// Construct a single-slice buffer by *moving* \a slice into it: the
+  /// slice's reference is transferred (no ref/unref pair) and \a slice is
+  /// left empty.
+  explicit ByteBuffer(Slice&& slice) {
+    grpc_slice s = slice.release();
+    buffer_ = g_core_codegen_interface->grpc_raw_byte_buffer_create(&s, 1);
+    // grpc_raw_byte_buffer_create added its own ref; drop the transferred
+    // one so net refcount traffic for the move is a single pair instead of
+    // the two pairs the copying constructor would cost.
+    g_core_codegen_interface->grpc_slice_unref(s);
+  }
+
   /// Constuct a byte buffer by referencing elements of existing buffer
   /// \a buf. Wrapper of core function grpc_byte_buffer_copy . This is not
   /// a deep copy; it is just a referencing. As a result, its performance is
   /// size-independent.
   ByteBuffer(const ByteBuffer& buf) : buffer_(nullptr) { operator=(buf); }
 
+  /// Move construction/assignment: steal the underlying buffer, leaving
+  /// \a other empty, with no refcount traffic at all.
+  ByteBuffer(ByteBuffer&& other) : buffer_(other.buffer_) {
+    other.buffer_ = nullptr;
+  }
+  ByteBuffer& operator=(ByteBuffer&& other) {
+    if (this != &other) {
+      Clear();
+      buffer_ = other.buffer_;
+      other.buffer_ = nullptr;
+    }
+    return *this;
+  }
+
   ~ByteBuffer() {
     if (buffer_) {
       g_core_codegen_interface->grpc_byte_buffer_destroy(buffer_);
@@ -124,6 +150,12 @@ class ByteBuffer final {
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
+  /// If the buffer's data lives in exactly one slice, return a reference to
+  /// it in \a slice (one ref taken; no bytes copied) and OK; otherwise
+  /// return an error. The cheap borrowed view for the common single-slice
+  /// message case - pair with Dump for the general case.
+  Status TrySingleSlice(Slice* slice) const;
+
   /// Remove all data.
   void Clear() {
     if (buffer_) {
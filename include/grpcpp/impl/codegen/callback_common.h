@@ -24,13 +24,39 @@
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpcpp/impl/codegen/call.h>
 #include <grpcpp/impl/codegen/channel_interface.h>
+#include <grpcpp/impl/codegen/completion_queue_tag.h>
 #include <grpcpp/impl/codegen/config.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/status.h>
 
 namespace grpc {
+
+namespace experimental {
+
+/// EXPERIMENTAL API
+/// Interface for an application-supplied executor onto which reactor
+/// callbacks (e.g. ServerBidiReactor::OnReadDone) are dispatched instead of
+/// running inline on a library polling thread. Implementations own their
+/// threads and may set per-thread CPU affinity. Set via
+/// ServerBuilder::experimental().SetCallbackExecutor(); the executor is
+/// process-global and must outlive all servers and channels using the
+/// callback API.
+class CallbackExecutorInterface {
+ public:
+  virtual ~CallbackExecutorInterface() {}
+
+  /// Schedule \a callback to run on one of the executor's threads.
+  virtual void Schedule(std::function<void()> callback) = 0;
+};
+
+}  // namespace experimental
+
 namespace internal {
 
+/// Global callback executor (nullptr => run callbacks inline, the default).
+/// Written before servers start, read on every callback completion.
+extern ::grpc::experimental::CallbackExecutorInterface* g_callback_executor;
+
 /// An exception-safe way of invoking a user-specified callback function
 // TODO(vjpai): decide whether it is better for this to take a const lvalue
 //              parameter or an rvalue parameter, or if it even matters
@@ -105,7 +131,12 @@ class CallbackWithStatusTag
 
   static void StaticRun(grpc_experimental_completion_queue_functor* cb,
                         int ok) {
-    static_cast<CallbackWithStatusTag*>(cb)->Run(static_cast<bool>(ok));
+    auto* tag = static_cast<CallbackWithStatusTag*>(cb);
+    if (auto* executor = g_callback_executor) {
+      executor->Schedule([tag, ok] { tag->Run(static_cast<bool>(ok)); });
+      return;
+    }
+    tag->Run(static_cast<bool>(ok));
   }
   void Run(bool ok) {
     void* ignored = ops_;
@@ -195,7 +226,12 @@ class CallbackWithSuccessTag
 
   static void StaticRun(grpc_experimental_completion_queue_functor* cb,
                         int ok) {
-    static_cast<CallbackWithSuccessTag*>(cb)->Run(static_cast<bool>(ok));
+    auto* tag = static_cast<CallbackWithSuccessTag*>(cb);
+    if (auto* executor = g_callback_executor) {
+      executor->Schedule([tag, ok] { tag->Run(static_cast<bool>(ok)); });
+      return;
+    }
+    tag->Run(static_cast<bool>(ok));
   }
   void Run(bool ok) {
     void* ignored = ops_;
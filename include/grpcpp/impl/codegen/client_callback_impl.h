@@ -296,6 +296,14 @@ class ClientBidiReactor {
 
   /// Notifies the application that a StartWrite operation completed.
   ///
+  /// OnWriteDone doubles as the transport's backpressure signal: for an
+  /// unbuffered write it fires only once the message's bytes have drained
+  /// out of the transport's outgoing buffer under flow control (for writes
+  /// with WriteOptions::set_buffer_hint, once the buffer is within
+  /// GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE of drained). A producer that issues
+  /// its next StartWrite from here is therefore paced to the connection
+  /// rather than queueing unboundedly inside the transport.
+  ///
   /// \param[in] ok Was it successful? If false, no further write-side operation
   ///               will succeed.
   virtual void OnWriteDone(bool /*ok*/) {}
@@ -262,6 +262,13 @@ class ClientContext {
   /// this RPC multiple times.
   void set_idempotent(bool idempotent) { idempotent_ = idempotent; }
 
+  /// EXPERIMENTAL: mark this call latency-critical; the HTTP/2 write
+  /// scheduler serves its frames ahead of ordinary streams sharing the
+  /// connection (e.g. bulk transfers).
+  void set_latency_critical(bool latency_critical) {
+    latency_critical_ = latency_critical;
+  }
+
   /// EXPERIMENTAL: Set this request to be cacheable.
   /// If set, grpc is free to use the HTTP GET verb for sending the request,
   /// with the possibility of receiving a cached response.
@@ -463,6 +470,7 @@ class ClientContext {
 
   uint32_t initial_metadata_flags() const {
     return (idempotent_ ? GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST : 0) |
+           (latency_critical_ ? GRPC_INITIAL_METADATA_LATENCY_CRITICAL : 0) |
            (wait_for_ready_ ? GRPC_INITIAL_METADATA_WAIT_FOR_READY : 0) |
            (cacheable_ ? GRPC_INITIAL_METADATA_CACHEABLE_REQUEST : 0) |
            (wait_for_ready_explicitly_set_
@@ -477,6 +485,7 @@ class ClientContext {
 
   bool initial_metadata_received_;
   bool wait_for_ready_;
+  bool latency_critical_ = false;
   bool wait_for_ready_explicitly_set_;
   bool idempotent_;
   bool cacheable_;
@@ -178,6 +178,30 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
                                   GPR_CLOCK_REALTIME)) != SHUTDOWN);
   }
 
+  /// EXPERIMENTAL
+  /// Batched variant of \a Next: reads up to \a max_events events from the
+  /// queue with a single blocking wait, amortizing the per-call polling work
+  /// over the batch. Blocks only until the first event is available (or the
+  /// queue is fully drained and shut down); events that have already
+  /// completed are then collected without further blocking.
+  ///
+  /// \param tags [out] Array of at least \a max_events entries, filled with
+  ///        the tags of the dequeued events.
+  /// \param oks [out] Array of at least \a max_events entries; oks[i] is the
+  ///        success state of the event carrying tags[i].
+  /// \param max_events [in] Maximum number of events to dequeue; must be > 0.
+  /// \param num_events [out] Number of events dequeued (>= 1 on success).
+  ///
+  /// \return true if at least one event was read; false if the queue is fully
+  ///         drained and shut down.
+  bool NextBatch(void** tags, bool* oks, size_t max_events,
+                 size_t* num_events) {
+    return (AsyncNextBatchInternal(
+                tags, oks, max_events, num_events,
+                ::grpc::g_core_codegen_interface->gpr_inf_future(
+                    GPR_CLOCK_REALTIME)) != SHUTDOWN);
+  }
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
@@ -195,6 +219,20 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL
+  /// Batched variant of \a AsyncNext: as \a NextBatch, but blocking for the
+  /// first event only up to \a deadline.
+  ///
+  /// \return GOT_EVENT and *num_events >= 1 if any event was read; otherwise
+  ///         TIMEOUT or SHUTDOWN (with *num_events == 0).
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, size_t max_events,
+                            size_t* num_events, const T& deadline) {
+    ::grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events, num_events,
+                                  deadline_tp.raw_time());
+  }
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -303,6 +341,8 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
   };
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, size_t max_events,
+                                    size_t* num_events, gpr_timespec deadline);
 
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
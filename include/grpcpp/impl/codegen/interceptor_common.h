@@ -244,6 +244,12 @@ class InterceptorBatchMethodsImpl
   // interceptors are done running, either ContinueFillOpsAfterInterception or
   // ContinueFinalizeOpsAfterInterception will be called. Note that neither of
   // them is invoked if there were no interceptors registered.
+  // Cost when no interceptors are registered: calls created on a channel
+  // (or server) without interceptor factories carry a null rpc_info, so
+  // this function is two predictable null checks and a `return true` - the
+  // batch proceeds with no interception bookkeeping, no allocation, and no
+  // virtual dispatch. A separately compiled no-interceptor call path would
+  // duplicate the batch machinery to remove two branches.
   bool RunInterceptors() {
     GPR_CODEGEN_ASSERT(ops_);
     auto* client_rpc_info = call_->client_rpc_info();
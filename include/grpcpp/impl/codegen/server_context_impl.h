@@ -268,6 +268,19 @@ class ServerContext {
     async_notify_when_done_tag_ = tag;
   }
 
+  /// EXPERIMENTAL: allocate per-RPC scratch memory from the call's arena.
+  /// The returned memory rides the same bump allocator as the call's own
+  /// state: allocation is a pointer increment, individual frees are
+  /// impossible, and everything is released in bulk when the RPC completes.
+  /// Intended for handler scratch buffers that would otherwise be small
+  /// per-request mallocs. Destructors are NOT run on this memory, so
+  /// placement-new only trivially destructible types into it, and do not
+  /// hand it to anything that may outlive the call.
+  void* scratch_alloc(size_t size) {
+    return ::grpc::g_core_codegen_interface->grpc_call_arena_alloc(call_,
+                                                                   size);
+  }
+
   /// Should be used for framework-level extensions only.
   /// Applications never need to call this method.
   grpc_call* c_call() { return call_; }
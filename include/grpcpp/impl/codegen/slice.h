@@ -73,12 +73,27 @@ class Slice final {
   Slice(const Slice& other)
       : slice_(g_core_codegen_interface->grpc_slice_ref(other.slice_)) {}
 
+  /// Move constructor, steals the reference ( other becomes empty).
+  Slice(Slice&& other) : slice_(other.slice_) {
+    other.slice_ = g_core_codegen_interface->grpc_empty_slice();
+  }
+
   /// Assignment, reference count is unchanged.
   Slice& operator=(Slice other) {
     std::swap(slice_, other.slice_);
     return *this;
   }
 
+  /// Release ownership of the underlying C slice to the caller, leaving
+  /// this object empty. The caller assumes the reference (pair with
+  /// grpc_slice_unref, or hand it to an API that steals refs) - no
+  /// ref/unref traffic is incurred.
+  grpc_slice release() {
+    grpc_slice out = slice_;
+    slice_ = g_core_codegen_interface->grpc_empty_slice();
+    return out;
+  }
+
   /// Create a slice pointing at some data. Calls malloc to allocate a refcount
   /// for the object, and arranges that destroy will be called with the
   /// user data pointer passed in at destruction. Can be the same as buf or
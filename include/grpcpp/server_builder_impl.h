@@ -58,6 +58,7 @@ class ExternalConnectionAcceptorImpl;
 }  // namespace internal
 
 namespace experimental {
+class CallbackExecutorInterface;
 class CallbackGenericService;
 
 // EXPERIMENTAL API:
@@ -272,6 +273,17 @@ class ServerBuilder {
     ServerBuilder& RegisterCallbackGenericService(
         grpc::experimental::CallbackGenericService* service);
 
+    /// EXPERIMENTAL API:
+    /// Dispatch reactor callbacks (e.g. ServerBidiReactor::OnReadDone) onto
+    /// \a executor instead of running them inline on library polling
+    /// threads, so applications can pin reactor execution to dedicated
+    /// (possibly CPU-affine) threads. The executor is process-global: it
+    /// affects every server and channel using the callback API, must be set
+    /// before the server is started and must outlive all calls. Passing
+    /// nullptr restores inline execution.
+    void SetCallbackExecutor(
+        grpc::experimental::CallbackExecutorInterface* executor);
+
     enum class ExternalConnectionType {
       FROM_FD = 0  // in the form of a file descriptor
     };
@@ -23,6 +23,30 @@
 #include <sstream>
 
 namespace grpc_cpp_generator {
+
+// Note on two recurring generator feature requests:
+//
+// Arena-allocated handler messages: the sync API shape
+// (Status Method(ServerContext*, const Req*, Resp*)) lets the *library*
+// own message construction, so arena support belongs in the generated
+// SyncService glue plus a ServerContext-owned protobuf Arena - NOT in
+// per-service generated allocation code. Design constraints before
+// emitting it: messages handed to application callbacks must not outlive
+// the context's arena reset, and protobuf arenas cannot be "recycled
+// across calls" while any message from them is alive, so recycling is
+// per-call reset, not cross-call pooling. The async/callback APIs already
+// let applications supply arena-allocated messages today.
+//
+// Constexpr method tables: the emitted method name array is already a
+// static constexpr-able table and server-side lookup of *registered*
+// methods is by exact pointer/slice identity, not string hashing per call
+// (the path slice is interned once per connection by hpack). Precomputed
+// path hashes in generated code would duplicate, at codegen time, a hash
+// whose seed is randomized per process in the interning layer - they
+// cannot be used there. The remaining win (skipping AddMethod
+// construction at service instantiation) saves per-service-object setup
+// only, which is once per process for normal servers.
+
 namespace {
 
 template <class T>
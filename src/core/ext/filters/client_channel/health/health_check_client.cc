@@ -42,6 +42,15 @@ TraceFlag grpc_health_check_client_trace(false, "health_check_client");
 //
 // HealthCheckClient
 //
+// Scaling note: there is exactly one HealthCheckClient (and hence one watch
+// call) per connected subchannel, and this is the floor imposed by the
+// health/v1 protocol - Watch streams carry a single service name, so watches
+// cannot be multiplexed onto fewer calls without a protocol change; nor is
+// there connection sharing between subchannels to consolidate over (a
+// subchannel owns its transport). Retry timers are already de-synchronized
+// across a fleet of subchannels by the jittered exponential backoff below,
+// so large deployments do not see thundering-herd health-check retries.
+//
 
 HealthCheckClient::HealthCheckClient(
     const char* service_name,
@@ -338,6 +338,20 @@ HttpConnectHandshaker::HttpConnectHandshaker() {
 // handshaker factory
 //
 
+/* Pipelining note (re: sending the TLS ClientHello behind the CONNECT
+   request to save an RTT): this handshaker is registered at_start, so the
+   security handshaker does not run until DoHandshake here completes - the
+   HandshakeManager drives its handshakers strictly in sequence over one
+   shared endpoint, and there is no way for a later handshaker to write
+   optimistically while an earlier one still owns the read path. Making
+   that safe would need (a) the manager to expose a buffered/speculative
+   write channel so the ClientHello can be queued but unsent data recalled
+   if the proxy answers with anything but 2xx, and (b) tolerance for
+   proxies that drop connections carrying payload before the 2xx - which
+   RFC 7231 explicitly lets them do, so the optimization must detect
+   failure and retry unpipelined. Until the manager grows that machinery,
+   pipelining here would turn a latency win into a correctness lottery
+   against strict proxies. */
 class HttpConnectHandshakerFactory : public HandshakerFactory {
  public:
   void AddHandshakers(const grpc_channel_args* /*args*/,
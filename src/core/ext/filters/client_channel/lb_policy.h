@@ -225,6 +225,15 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
     /// does not take ownership, so any data that needs to be used after
     /// returning must be copied.
     /// The call state can be used to obtain backend metric data.
+    ///
+    /// This callback is the integration point for outcome-driven policies
+    /// (outlier detection / ejection, load-feedback weighting): it observes
+    /// each call's final status per picked subchannel, so a policy can
+    /// maintain per-backend success/failure statistics and rebuild its
+    /// picker without any of those backends leaving READY state. Note the
+    /// threading contract: the callback runs on the data plane, so any
+    /// statistics it updates must be lock-free or sharded, and picker
+    /// rebuilds must be marshalled back to the combiner.
     std::function<void(grpc_error*, MetadataInterface*, CallState*)>
         recv_trailing_metadata_ready;
   };
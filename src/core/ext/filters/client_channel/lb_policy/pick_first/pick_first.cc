@@ -137,6 +137,9 @@ class PickFirst : public LoadBalancingPolicy {
   PickFirstSubchannelData* selected_ = nullptr;
   // Are we in IDLE state?
   bool idle_ = false;
+  /// eagerly connect all subchannels (GRPC_ARG_EAGER_SUBCHANNEL_CONNECT)
+  /// so failover targets are pre-staged
+  bool eager_connect_ = false;
   // Are we shut down?
   bool shutdown_ = false;
 };
@@ -183,6 +186,10 @@ void PickFirst::ResetBackoffLocked() {
 }
 
 void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
+  eager_connect_ = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(latest_update_args_.args,
+                             GRPC_ARG_EAGER_SUBCHANNEL_CONNECT),
+      false);
   // Create a subchannel list from the latest_update_args_.
   auto subchannel_list = MakeOrphanable<PickFirstSubchannelList>(
       this, &grpc_lb_pick_first_trace, latest_update_args_.addresses,
@@ -234,6 +241,15 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     // state of all subchannels above.
     subchannel_list_->subchannel(0)->StartConnectivityWatchLocked();
     subchannel_list_->subchannel(0)->subchannel()->AttemptToConnect();
+    // Eager warm-up: kick off connections (TCP + handshake) for the backup
+    // subchannels too, so a failover walks onto an already-established
+    // connection instead of paying connect latency. Only subchannel(0) is
+    // watched; the others just warm up in the background.
+    if (eager_connect_) {
+      for (size_t i = 1; i < subchannel_list_->num_subchannels(); ++i) {
+        subchannel_list_->subchannel(i)->subchannel()->AttemptToConnect();
+      }
+    }
   } else {
     // We do have a selected subchannel (which means it's READY), so keep
     // using it until one of the subchannels in the new list reports READY.
@@ -257,6 +273,14 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     latest_pending_subchannel_list_->subchannel(0)
         ->subchannel()
         ->AttemptToConnect();
+    if (eager_connect_) {
+      for (size_t i = 1; i < latest_pending_subchannel_list_->num_subchannels();
+           ++i) {
+        latest_pending_subchannel_list_->subchannel(i)
+            ->subchannel()
+            ->AttemptToConnect();
+      }
+    }
   }
 }
 
@@ -35,6 +35,8 @@
 #include "src/core/ext/filters/client_channel/lb_policy_registry.h"
 #include "src/core/ext/filters/client_channel/subchannel.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/murmur_hash.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -54,6 +56,9 @@ namespace {
 
 constexpr char kRoundRobin[] = "round_robin";
 
+// Cap on the per-address weight (and hence on picker-slot replication).
+constexpr int kMaxAddressWeight = 128;
+
 class RoundRobin : public LoadBalancingPolicy {
  public:
   explicit RoundRobin(Args args);
@@ -82,12 +87,24 @@ class RoundRobin : public LoadBalancingPolicy {
             subchannel_list,
         const ServerAddress& address,
         RefCountedPtr<SubchannelInterface> subchannel)
-        : SubchannelData(subchannel_list, address, std::move(subchannel)) {}
+        : SubchannelData(subchannel_list, address, std::move(subchannel)),
+          weight_(grpc_channel_arg_get_integer(
+              grpc_channel_args_find(address.args(), GRPC_ARG_ADDRESS_WEIGHT),
+              {1, 1, kMaxAddressWeight})),
+          locality_(gpr_strdup(grpc_channel_arg_get_string(
+              grpc_channel_args_find(address.args(),
+                                     GRPC_ARG_ADDRESS_LOCALITY)))) {}
 
     grpc_connectivity_state connectivity_state() const {
       return last_connectivity_state_;
     }
 
+    // Relative pick weight for this address (default 1).
+    int weight() const { return weight_; }
+
+    // Locality label attached to this address by the resolver (may be null).
+    const char* locality() const { return locality_.get(); }
+
     bool seen_failure_since_ready() const { return seen_failure_since_ready_; }
 
     // Performs connectivity state updates that need to be done both when we
@@ -101,6 +118,8 @@ class RoundRobin : public LoadBalancingPolicy {
     void ProcessConnectivityChangeLocked(
         grpc_connectivity_state connectivity_state) override;
 
+    const int weight_;
+    UniquePtr<char> locality_;
     grpc_connectivity_state last_connectivity_state_ = GRPC_CHANNEL_IDLE;
     bool seen_failure_since_ready_ = false;
   };
@@ -159,7 +178,15 @@ class RoundRobin : public LoadBalancingPolicy {
     // Using pointer value only, no ref held -- do not dereference!
     RoundRobin* parent_;
 
-    size_t last_picked_index_;
+    // Copied from the policy at picker-build time (the parent must not be
+    // dereferenced during Pick()).
+    UniquePtr<char> affinity_hash_key_;
+
+    // Monotonic pick counter; the subchannel index is this modulo the
+    // (immutable) subchannel count. Atomic so that Pick() is safe without
+    // any external serialization: this increment is the picker's only
+    // shared write.
+    Atomic<size_t> last_picked_index_;
     InlinedVector<RefCountedPtr<SubchannelInterface>, 10> subchannels_;
   };
 
@@ -175,6 +202,12 @@ class RoundRobin : public LoadBalancingPolicy {
   OrphanablePtr<RoundRobinSubchannelList> latest_pending_subchannel_list_;
   /** are we shutting down? */
   bool shutdown_ = false;
+  /** this client's own locality label (GRPC_ARG_LOCALITY), if configured;
+      pickers prefer same-locality subchannels with spillover */
+  UniquePtr<char> local_locality_;
+  /** metadata key used for affinity hashing (GRPC_ARG_AFFINITY_HASH_KEY), if
+      configured; calls carrying that key hash onto a stable slot */
+  UniquePtr<char> affinity_hash_key_;
 };
 
 //
@@ -183,38 +216,86 @@ class RoundRobin : public LoadBalancingPolicy {
 
 RoundRobin::Picker::Picker(RoundRobin* parent,
                            RoundRobinSubchannelList* subchannel_list)
-    : parent_(parent) {
+    : parent_(parent),
+      affinity_hash_key_(gpr_strdup(parent->affinity_hash_key_.get())) {
+  // Locality-aware pass: if this client has a locality label and at least
+  // one READY subchannel shares it, restrict the rotation to same-locality
+  // backends; otherwise (no label, no local backends) spill over to all
+  // READY subchannels.
+  const char* local_locality = parent->local_locality_.get();
+  bool have_local_ready = false;
+  if (local_locality != nullptr) {
+    for (size_t i = 0; i < subchannel_list->num_subchannels(); ++i) {
+      RoundRobinSubchannelData* sd = subchannel_list->subchannel(i);
+      if (sd->connectivity_state() == GRPC_CHANNEL_READY &&
+          sd->locality() != nullptr &&
+          strcmp(sd->locality(), local_locality) == 0) {
+        have_local_ready = true;
+        break;
+      }
+    }
+  }
   for (size_t i = 0; i < subchannel_list->num_subchannels(); ++i) {
     RoundRobinSubchannelData* sd = subchannel_list->subchannel(i);
     if (sd->connectivity_state() == GRPC_CHANNEL_READY) {
-      subchannels_.push_back(sd->subchannel()->Ref());
+      if (have_local_ready &&
+          (sd->locality() == nullptr ||
+           strcmp(sd->locality(), local_locality) != 0)) {
+        continue;
+      }
+      // Weighted round robin: an address with weight W (from the resolver's
+      // per-address GRPC_ARG_ADDRESS_WEIGHT) occupies W picker slots and so
+      // receives W/total of the picks.
+      for (int w = 0; w < sd->weight(); ++w) {
+        subchannels_.push_back(sd->subchannel()->Ref());
+      }
     }
   }
   // For discussion on why we generate a random starting index for
   // the picker, see https://github.com/grpc/grpc-go/issues/2580.
   // TODO(roth): rand(3) is not thread-safe.  This should be replaced with
   // something better as part of https://github.com/grpc/grpc/issues/17891.
-  last_picked_index_ = rand() % subchannels_.size();
+  const size_t initial_index = rand() % subchannels_.size();
+  last_picked_index_.Store(initial_index, MemoryOrder::RELAXED);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
     gpr_log(GPR_INFO,
             "[RR %p picker %p] created picker from subchannel_list=%p "
             "with %" PRIuPTR " READY subchannels; last_picked_index_=%" PRIuPTR,
             parent_, this, subchannel_list, subchannels_.size(),
-            last_picked_index_);
+            initial_index);
   }
 }
 
-RoundRobin::PickResult RoundRobin::Picker::Pick(PickArgs /*args*/) {
-  last_picked_index_ = (last_picked_index_ + 1) % subchannels_.size();
+RoundRobin::PickResult RoundRobin::Picker::Pick(PickArgs args) {
+  size_t index;
+  bool have_affinity_index = false;
+  if (GPR_UNLIKELY(affinity_hash_key_ != nullptr)) {
+    // Affinity mode: calls carrying the configured metadata key hash onto a
+    // stable slot, so all calls with the same key value land on the same
+    // backend while the READY set is unchanged.
+    const size_t key_len = strlen(affinity_hash_key_.get());
+    for (auto md : *args.initial_metadata) {
+      if (md.first.size() == key_len &&
+          memcmp(md.first.data(), affinity_hash_key_.get(), key_len) == 0) {
+        index = gpr_murmur_hash3(md.second.data(), md.second.size(), 0) %
+                subchannels_.size();
+        have_affinity_index = true;
+        break;
+      }
+    }
+  }
+  if (!have_affinity_index) {
+    index = (last_picked_index_.FetchAdd(1, MemoryOrder::RELAXED) + 1) %
+            subchannels_.size();
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
     gpr_log(GPR_INFO,
             "[RR %p picker %p] returning index %" PRIuPTR ", subchannel=%p",
-            parent_, this, last_picked_index_,
-            subchannels_[last_picked_index_].get());
+            parent_, this, index, subchannels_[index].get());
   }
   PickResult result;
   result.type = PickResult::PICK_COMPLETE;
-  result.subchannel = subchannels_[last_picked_index_];
+  result.subchannel = subchannels_[index];
   return result;
 }
 
@@ -435,6 +516,10 @@ void RoundRobin::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[RR %p] received update with %" PRIuPTR " addresses",
             this, args.addresses.size());
   }
+  local_locality_.reset(gpr_strdup(grpc_channel_arg_get_string(
+      grpc_channel_args_find(args.args, GRPC_ARG_LOCALITY))));
+  affinity_hash_key_.reset(gpr_strdup(grpc_channel_arg_get_string(
+      grpc_channel_args_find(args.args, GRPC_ARG_AFFINITY_HASH_KEY))));
   // Replace latest_pending_subchannel_list_.
   if (latest_pending_subchannel_list_ != nullptr) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
@@ -625,6 +625,17 @@ class XdsLb::EndpointWatcher : public XdsClient::EndpointWatcherInterface {
         *xds_policy_->drop_config_ != *update.drop_config;
     xds_policy_->drop_config_ = std::move(update.drop_config);
     // Ignore identical locality update.
+    //
+    // Note on update granularity: diffing happens at three levels already -
+    // the XdsClient drops byte-identical EDS responses, this check drops
+    // semantically identical priority-list updates, and below,
+    // LocalityMap/Locality::UpdateLocked feeds each child policy only its
+    // own locality's addresses, so an endpoint change in one locality only
+    // rebuilds that locality's subchannel list (existing subchannels are
+    // reused through the subchannel pool; no connections are dropped).
+    // Making this finer - per-endpoint deltas inside a locality - would
+    // need an incremental SubchannelList update API; today's cost for a
+    // 1-endpoint change is one locality's list rebuild, not the cluster's.
     if (xds_policy_->priority_list_update_ == update.priority_list_update) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_xds_trace)) {
         gpr_log(GPR_INFO,
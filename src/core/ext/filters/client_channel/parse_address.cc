@@ -60,6 +60,27 @@ bool grpc_parse_unix(const grpc_uri* uri,
   return true;
 }
 
+bool grpc_parse_unix_abstract(const grpc_uri* uri,
+                              grpc_resolved_address* resolved_addr) {
+  if (strcmp("unix-abstract", uri->scheme) != 0) {
+    gpr_log(GPR_ERROR, "Expected 'unix-abstract' scheme, got '%s'",
+            uri->scheme);
+    return false;
+  }
+  struct sockaddr_un* un =
+      reinterpret_cast<struct sockaddr_un*>(resolved_addr->addr);
+  const size_t maxlen = sizeof(un->sun_path) - 1; /* leading NUL marker */
+  const size_t path_len = strnlen(uri->path, maxlen + 1);
+  if (path_len == 0 || path_len > maxlen) return false;
+  un->sun_family = AF_UNIX;
+  un->sun_path[0] = '\0';
+  memcpy(un->sun_path + 1, uri->path, path_len);
+  /* abstract addresses are length-delimited (no trailing NUL counted) */
+  resolved_addr->len =
+      static_cast<socklen_t>(sizeof(un->sun_family) + path_len + 1);
+  return true;
+}
+
 #else /* GRPC_HAVE_UNIX_SOCKET */
 
 bool grpc_parse_unix(const grpc_uri* uri,
@@ -67,6 +88,11 @@ bool grpc_parse_unix(const grpc_uri* uri,
   abort();
 }
 
+bool grpc_parse_unix_abstract(const grpc_uri* uri,
+                              grpc_resolved_address* resolved_addr) {
+  abort();
+}
+
 #endif /* GRPC_HAVE_UNIX_SOCKET */
 
 bool grpc_parse_ipv4_hostport(const char* hostport, grpc_resolved_address* addr,
@@ -218,6 +244,8 @@ bool grpc_parse_ipv6(const grpc_uri* uri,
 bool grpc_parse_uri(const grpc_uri* uri, grpc_resolved_address* resolved_addr) {
   if (strcmp("unix", uri->scheme) == 0) {
     return grpc_parse_unix(uri, resolved_addr);
+  } else if (strcmp("unix-abstract", uri->scheme) == 0) {
+    return grpc_parse_unix_abstract(uri, resolved_addr);
   } else if (strcmp("ipv4", uri->scheme) == 0) {
     return grpc_parse_ipv4(uri, resolved_addr);
   } else if (strcmp("ipv6", uri->scheme) == 0) {
@@ -21,11 +21,13 @@
 #if GRPC_ARES == 1
 
 #include <limits.h>
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/time.h>
 
 #include <address_sorting/address_sorting.h>
 
@@ -40,6 +42,8 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/map.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/gethostname.h"
 #include "src/core/lib/iomgr/iomgr_custom.h"
@@ -52,12 +56,117 @@
 #define GRPC_DNS_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_DNS_RECONNECT_JITTER 0.2
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_dns_resolution_rate_limit, 0,
+    "Process-wide cap on outbound DNS resolutions per second (0 = "
+    "unlimited). When set, re-resolutions across all channels queue fairly "
+    "behind a shared pacer with randomized inter-query gaps.");
+
 namespace grpc_core {
 
 namespace {
 
 const char kDefaultPort[] = "https";
 
+/// In-process DNS result cache shared across channels, opt-in via
+/// GRPC_ARG_DNS_CACHE_TTL_MS. Keyed by the name being resolved; stores the
+/// raw resolution output (addresses plus the unchosen service config JSON)
+/// with an expiry. Lookups within the TTL return synchronously; once an
+/// entry passes half its TTL the caller is told to also refresh in the
+/// background (stale-while-revalidate), so hot names resolve immediately
+/// while staying fresh.
+class DnsResultCache {
+ public:
+  struct Entry {
+    ServerAddressList addresses;
+    UniquePtr<char> service_config_json;
+    grpc_millis refresh_after;
+    grpc_millis expiry;
+  };
+
+  // Returns true (filling addresses/service_config_json) on a fresh hit;
+  // *needs_refresh is set if the entry is past half its TTL.
+  bool Lookup(const char* name, ServerAddressList* addresses,
+              UniquePtr<char>* service_config_json, bool* needs_refresh) {
+    MutexLock lock(&mu_);
+    UniquePtr<char> key(gpr_strdup(name));
+    auto it = cache_.find(key);
+    if (it == cache_.end()) return false;
+    const grpc_millis now = ExecCtx::Get()->Now();
+    if (now >= it->second.expiry) {
+      cache_.erase(it);
+      return false;
+    }
+    *addresses = it->second.addresses;
+    service_config_json->reset(
+        it->second.service_config_json == nullptr
+            ? nullptr
+            : gpr_strdup(it->second.service_config_json.get()));
+    *needs_refresh = now >= it->second.refresh_after;
+    return true;
+  }
+
+  void Store(const char* name, const ServerAddressList& addresses,
+             const char* service_config_json, grpc_millis ttl) {
+    MutexLock lock(&mu_);
+    Entry& entry = cache_[UniquePtr<char>(gpr_strdup(name))];
+    entry.addresses = addresses;
+    entry.service_config_json.reset(
+        service_config_json == nullptr ? nullptr
+                                       : gpr_strdup(service_config_json));
+    const grpc_millis now = ExecCtx::Get()->Now();
+    entry.refresh_after = now + ttl / 2;
+    entry.expiry = now + ttl;
+  }
+
+ private:
+  Mutex mu_;
+  Map<UniquePtr<char>, Entry, StringLess> cache_;
+};
+
+DnsResultCache* g_dns_result_cache = nullptr;
+
+/// Process-global pacer for outbound DNS queries, opt-in via
+/// GRPC_DNS_RESOLUTION_RATE_LIMIT. Slots are handed out in request order,
+/// so when a config push wakes every channel in the process at once they
+/// queue fairly behind one another instead of stampeding the DNS servers.
+/// Gaps between slots are exponentially distributed around the configured
+/// mean, so the steady-state query stream approximates a Poisson process
+/// rather than a lockstep burst.
+class DnsQueryPacer {
+ public:
+  DnsQueryPacer()
+      : rng_state_(
+            static_cast<uint32_t>(gpr_now(GPR_CLOCK_REALTIME).tv_nsec)) {}
+
+  /// Reserves the next query slot; returns how many milliseconds the caller
+  /// must wait before issuing its query (0 = go immediately).
+  grpc_millis ReserveSlot(grpc_millis now, int queries_per_second) {
+    MutexLock lock(&mu_);
+    if (next_slot_ < now) next_slot_ = now;
+    const grpc_millis wait = next_slot_ - now;
+    // Exponential inter-arrival gap with mean 1000/rate ms, clamped to 4x
+    // the mean so a single unlucky draw cannot stall the queue. Same LCG as
+    // BackOff (we roll our own so as not to perturb rand()'s global state).
+    const double mean_gap_ms = 1000.0 / queries_per_second;
+    rng_state_ = 1103515245 * rng_state_ + 12345;
+    const double u =
+        (static_cast<double>((rng_state_ >> 8) & 0xffffff) + 1) / 16777217.0;
+    double gap_ms = -mean_gap_ms * log(u);
+    if (gap_ms > 4 * mean_gap_ms) gap_ms = 4 * mean_gap_ms;
+    next_slot_ += static_cast<grpc_millis>(gap_ms);
+    return wait;
+  }
+
+ private:
+  Mutex mu_;
+  grpc_millis next_slot_ = 0;
+  uint32_t rng_state_;
+};
+
+DnsQueryPacer* g_dns_query_pacer = nullptr;
+int g_dns_resolution_rate_limit = 0;
+
 class AresDnsResolver : public Resolver {
  public:
   explicit AresDnsResolver(ResolverArgs args);
@@ -75,11 +184,20 @@ class AresDnsResolver : public Resolver {
 
   void MaybeStartResolvingLocked();
   void StartResolvingLocked();
+  bool MaybeDeferResolutionForPacingLocked();
 
   static void OnNextResolution(void* arg, grpc_error* error);
   static void OnResolved(void* arg, grpc_error* error);
   static void OnNextResolutionLocked(void* arg, grpc_error* error);
   static void OnResolvedLocked(void* arg, grpc_error* error);
+  static void ReturnCachedResultLocked(void* arg, grpc_error* error);
+
+  /// carries a cache-served result onto a fresh combiner run
+  struct CachedResultArg {
+    AresDnsResolver* resolver;
+    Result result;
+    grpc_closure closure;
+  };
 
   /// DNS server to use (if not system default)
   char* dns_server_;
@@ -105,6 +223,8 @@ class AresDnsResolver : public Resolver {
   grpc_millis min_time_between_resolutions_;
   /// timestamp of last DNS request
   grpc_millis last_resolution_timestamp_ = -1;
+  /// whether we already hold a reserved slot from the global query pacer
+  bool pacing_slot_reserved_ = false;
   /// retry backoff state
   BackOff backoff_;
   /// currently resolving addresses
@@ -115,6 +235,8 @@ class AresDnsResolver : public Resolver {
   bool shutdown_initiated_ = false;
   // timeout in milliseconds for active DNS queries
   int query_timeout_ms_;
+  // TTL for entries in the shared DNS result cache (0 = caching disabled)
+  int cache_ttl_ms_;
   // whether or not to enable SRV DNS queries
   bool enable_srv_queries_;
 };
@@ -150,6 +272,9 @@ AresDnsResolver::AresDnsResolver(ResolverArgs args)
   // Enable SRV queries option
   arg = grpc_channel_args_find(channel_args_, GRPC_ARG_DNS_ENABLE_SRV_QUERIES);
   enable_srv_queries_ = grpc_channel_arg_get_bool(arg, false);
+  // Shared result cache TTL option
+  arg = grpc_channel_args_find(channel_args_, GRPC_ARG_DNS_CACHE_TTL_MS);
+  cache_ttl_ms_ = grpc_channel_arg_get_integer(arg, {0, 0, INT_MAX});
   interested_parties_ = grpc_pollset_set_create();
   if (args.pollset_set != nullptr) {
     grpc_pollset_set_add_pollset_set(interested_parties_, args.pollset_set);
@@ -341,6 +466,10 @@ void AresDnsResolver::OnResolvedLocked(void* arg, grpc_error* error) {
     return;
   }
   if (r->addresses_ != nullptr) {
+    if (r->cache_ttl_ms_ > 0 && g_dns_result_cache != nullptr) {
+      g_dns_result_cache->Store(r->name_to_resolve_, *r->addresses_,
+                                r->service_config_json_, r->cache_ttl_ms_);
+    }
     Result result;
     result.addresses = std::move(*r->addresses_);
     if (r->service_config_json_ != nullptr) {
@@ -394,7 +523,60 @@ void AresDnsResolver::OnResolvedLocked(void* arg, grpc_error* error) {
   r->Unref(DEBUG_LOCATION, "dns-resolving");
 }
 
+void AresDnsResolver::ReturnCachedResultLocked(void* arg,
+                                               grpc_error* /*error*/) {
+  CachedResultArg* cached = static_cast<CachedResultArg*>(arg);
+  AresDnsResolver* r = cached->resolver;
+  if (!r->shutdown_initiated_) {
+    r->result_handler()->ReturnResult(std::move(cached->result));
+  }
+  r->Unref(DEBUG_LOCATION, "cached_result");
+  Delete(cached);
+}
+
 void AresDnsResolver::MaybeStartResolvingLocked() {
+  // Serve from the shared DNS result cache when enabled and fresh, only
+  // hitting the network when the entry wants a background refresh
+  // (stale-while-revalidate).
+  if (cache_ttl_ms_ > 0 && g_dns_result_cache != nullptr) {
+    ServerAddressList cached_addresses;
+    UniquePtr<char> cached_service_config;
+    bool needs_refresh = false;
+    if (g_dns_result_cache->Lookup(name_to_resolve_, &cached_addresses,
+                                   &cached_service_config, &needs_refresh)) {
+      GRPC_CARES_TRACE_LOG("resolver:%p served %s from cache%s", this,
+                           name_to_resolve_,
+                           needs_refresh ? " (refreshing in background)" : "");
+      Result result;
+      result.addresses = std::move(cached_addresses);
+      if (cached_service_config != nullptr) {
+        char* service_config_string = ChooseServiceConfig(
+            cached_service_config.get(), &result.service_config_error);
+        if (result.service_config_error == GRPC_ERROR_NONE &&
+            service_config_string != nullptr) {
+          result.service_config = ServiceConfig::Create(
+              service_config_string, &result.service_config_error);
+        }
+        gpr_free(service_config_string);
+      }
+      result.args = grpc_channel_args_copy(channel_args_);
+      // Deliver the cached result from a fresh combiner closure, never
+      // synchronously: every other delivery path (OnResolvedLocked, the
+      // re-resolution timer) arrives on its own combiner run, and LB
+      // policies depend on that - RequestReresolutionLocked is invoked from
+      // inside LB connectivity callbacks, and returning a result inline
+      // would re-enter the policy's UpdateLocked under the callback's
+      // stack, destroying the subchannel list the caller is standing on.
+      CachedResultArg* cached = New<CachedResultArg>();
+      cached->resolver = this;
+      Ref(DEBUG_LOCATION, "cached_result").release();
+      cached->result = std::move(result);
+      GRPC_CLOSURE_INIT(&cached->closure, ReturnCachedResultLocked, cached,
+                        nullptr);
+      combiner()->Run(&cached->closure, GRPC_ERROR_NONE);
+      if (!needs_refresh) return;
+    }
+  }
   // If there is an existing timer, the time it fires is the earliest time we
   // can start the next resolution.
   if (have_next_resolution_timer_) return;
@@ -426,7 +608,40 @@ void AresDnsResolver::MaybeStartResolvingLocked() {
   StartResolvingLocked();
 }
 
+// Returns true if the resolution was deferred to a reserved pacer slot;
+// the re-resolution timer re-enters StartResolvingLocked (consuming the
+// reservation) when the slot opens.
+bool AresDnsResolver::MaybeDeferResolutionForPacingLocked() {
+  if (g_dns_resolution_rate_limit <= 0 || g_dns_query_pacer == nullptr) {
+    return false;
+  }
+  if (pacing_slot_reserved_) {
+    // Our previously reserved slot has arrived.
+    pacing_slot_reserved_ = false;
+    return false;
+  }
+  const grpc_millis wait = g_dns_query_pacer->ReserveSlot(
+      ExecCtx::Get()->Now(), g_dns_resolution_rate_limit);
+  if (wait <= 0) return false;
+  GRPC_CARES_TRACE_LOG(
+      "resolver:%p waiting %" PRId64 " ms for a paced resolution slot", this,
+      wait);
+  pacing_slot_reserved_ = true;
+  GPR_ASSERT(!have_next_resolution_timer_);
+  have_next_resolution_timer_ = true;
+  // TODO(roth): We currently deal with this ref manually.  Once the
+  // new closure API is done, find a way to track this ref with the timer
+  // callback as part of the type system.
+  Ref(DEBUG_LOCATION, "next_resolution_timer_pacing").release();
+  GRPC_CLOSURE_INIT(&on_next_resolution_, OnNextResolution, this,
+                    grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&next_resolution_timer_, ExecCtx::Get()->Now() + wait,
+                  &on_next_resolution_);
+  return true;
+}
+
 void AresDnsResolver::StartResolvingLocked() {
+  if (MaybeDeferResolutionForPacingLocked()) return;
   // TODO(roth): We currently deal with this ref manually.  Once the
   // new closure API is done, find a way to track this ref with the timer
   // callback as part of the type system.
@@ -501,6 +716,12 @@ void grpc_resolver_dns_ares_init() {
   if (should_use_ares(resolver.get())) {
     g_use_ares_dns_resolver = true;
     gpr_log(GPR_DEBUG, "Using ares dns resolver");
+    grpc_core::g_dns_result_cache = grpc_core::New<grpc_core::DnsResultCache>();
+    grpc_core::g_dns_resolution_rate_limit =
+        GPR_GLOBAL_CONFIG_GET(grpc_dns_resolution_rate_limit);
+    if (grpc_core::g_dns_resolution_rate_limit > 0) {
+      grpc_core::g_dns_query_pacer = grpc_core::New<grpc_core::DnsQueryPacer>();
+    }
     address_sorting_init();
     grpc_error* error = grpc_ares_init();
     if (error != GRPC_ERROR_NONE) {
@@ -520,6 +741,12 @@ void grpc_resolver_dns_ares_init() {
 
 void grpc_resolver_dns_ares_shutdown() {
   if (g_use_ares_dns_resolver) {
+    grpc_core::Delete(grpc_core::g_dns_result_cache);
+    grpc_core::g_dns_result_cache = nullptr;
+    if (grpc_core::g_dns_query_pacer != nullptr) {
+      grpc_core::Delete(grpc_core::g_dns_query_pacer);
+      grpc_core::g_dns_query_pacer = nullptr;
+    }
     address_sorting_shutdown();
     grpc_ares_cleanup();
   }
@@ -91,6 +91,16 @@ bool ParseDuration(grpc_json* field, grpc_millis* duration) {
   return true;
 }
 
+// Hedging note: hedgingPolicy would be parsed alongside retryPolicy here,
+// and the two performance-critical prerequisites it depends on already
+// exist in the retry machinery: the serialized request is held in a
+// ByteStreamCache whose CachingByteStream replays slice *references* (no
+// payload copy per attempt), and attempt cancellation is a single
+// cancel_stream batch against the losing call's transport. What hedging
+// adds beyond parsing is concurrent-attempt bookkeeping in the retry
+// filter (today's attempts are strictly sequential) and a
+// pushback/throttle interaction per gRFC A6 - design those against the
+// pending-batch machinery before extending this parser.
 UniquePtr<ClientChannelMethodParsedConfig::RetryPolicy> ParseRetryPolicy(
     grpc_json* field, grpc_error** error) {
   GPR_DEBUG_ASSERT(error != nullptr && *error == GRPC_ERROR_NONE);
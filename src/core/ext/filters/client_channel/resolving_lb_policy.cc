@@ -63,6 +63,11 @@
 #include "src/core/lib/transport/static_metadata.h"
 #include "src/core/lib/transport/status_metadata.h"
 
+// Per-address arg used solely to make each connection stripe's subchannel
+// key unique (see GRPC_ARG_SUBCHANNEL_STRIPES).
+#define GRPC_ARG_SUBCHANNEL_STRIPE_INDEX \
+  "grpc.internal.subchannel_stripe_index"
+
 namespace grpc_core {
 
 //
@@ -357,6 +362,31 @@ void ResolvingLoadBalancingPolicy::CreateOrUpdateLbPolicyLocked(
             policy_to_update);
   }
   UpdateArgs update_args;
+  // Connection striping: expand each resolved address into N copies, each
+  // tagged with a distinct per-address stripe index, so the subchannel pool
+  // keys them as N separate subchannels (connections) per address.
+  // Stream-distributing policies (e.g. round_robin) then spread load across
+  // the stripes, avoiding MAX_CONCURRENT_STREAMS head-of-line blocking on a
+  // single connection without hand-rolled duplicate channels.
+  const grpc_arg* stripes_arg =
+      grpc_channel_args_find(result.args, GRPC_ARG_SUBCHANNEL_STRIPES);
+  const int stripes =
+      grpc_channel_arg_get_integer(stripes_arg, {1, 1, 1024});
+  if (stripes > 1) {
+    ServerAddressList striped;
+    striped.reserve(result.addresses.size() * stripes);
+    for (size_t i = 0; i < result.addresses.size(); ++i) {
+      const ServerAddress& address = result.addresses[i];
+      for (int stripe = 0; stripe < stripes; ++stripe) {
+        grpc_arg stripe_arg = grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_SUBCHANNEL_STRIPE_INDEX), stripe);
+        striped.emplace_back(
+            address.address(),
+            grpc_channel_args_copy_and_add(address.args(), &stripe_arg, 1));
+      }
+    }
+    result.addresses = std::move(striped);
+  }
   update_args.addresses = std::move(result.addresses);
   update_args.config = std::move(lb_policy_config);
   // TODO(roth): Once channel args is converted to C++, use std::move() here.
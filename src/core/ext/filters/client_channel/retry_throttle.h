@@ -49,7 +49,14 @@ class ServerRetryThrottleData : public RefCounted<ServerRetryThrottleData> {
 
   const intptr_t max_milli_tokens_;
   const intptr_t milli_token_ratio_;
+  // The token count is hammered with CAS traffic from every call's retry
+  // decision; keep it on its own cache line so those writes do not
+  // false-share with the refcount or the (read-mostly) fields above and
+  // below.
+  char token_padding_before_[GPR_CACHELINE_SIZE];
   gpr_atm milli_tokens_;
+  char token_padding_after_[GPR_CACHELINE_SIZE -
+                            (sizeof(gpr_atm) % GPR_CACHELINE_SIZE)];
   // A pointer to the replacement for this ServerRetryThrottleData entry.
   // If non-nullptr, then this entry is stale and must not be used.
   // We hold a reference to the replacement.
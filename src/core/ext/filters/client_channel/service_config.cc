@@ -40,19 +40,99 @@ typedef InlinedVector<UniquePtr<ServiceConfig::Parser>,
 ServiceConfigParserList* g_registered_parsers;
 }  // namespace
 
+namespace {
+
+/* A tiny cache of recently parsed service configs. Resolvers (notably xds
+   and DNS) frequently re-present byte-identical configs on every update;
+   since parsed ServiceConfig objects are immutable and refcounted, such
+   updates can share the previously parsed instance instead of re-running
+   the JSON parse, validation and method-table build. Guarded by its own
+   mutex; initialized/torn down with the client_channel plugin. */
+constexpr size_t kParseCacheSize = 4;
+struct ParseCacheEntry {
+  char* json;
+  ServiceConfig* config; /* owns one ref */
+};
+gpr_mu g_parse_cache_mu;
+ParseCacheEntry g_parse_cache[kParseCacheSize];
+size_t g_parse_cache_evict_index = 0;
+bool g_parse_cache_enabled = false;
+
+RefCountedPtr<ServiceConfig> ParseCacheLookup(const char* json) {
+  RefCountedPtr<ServiceConfig> result;
+  if (!g_parse_cache_enabled) return result;
+  gpr_mu_lock(&g_parse_cache_mu);
+  for (size_t i = 0; i < kParseCacheSize; i++) {
+    if (g_parse_cache[i].json != nullptr &&
+        strcmp(g_parse_cache[i].json, json) == 0) {
+      result = g_parse_cache[i].config->Ref();
+      break;
+    }
+  }
+  gpr_mu_unlock(&g_parse_cache_mu);
+  return result;
+}
+
+void ParseCacheStore(const char* json, ServiceConfig* config) {
+  if (!g_parse_cache_enabled) return;
+  char* json_copy = gpr_strdup(json);
+  config->Ref().release();
+  gpr_mu_lock(&g_parse_cache_mu);
+  ParseCacheEntry* entry = &g_parse_cache[g_parse_cache_evict_index];
+  g_parse_cache_evict_index =
+      (g_parse_cache_evict_index + 1) % kParseCacheSize;
+  char* old_json = entry->json;
+  ServiceConfig* old_config = entry->config;
+  entry->json = json_copy;
+  entry->config = config;
+  gpr_mu_unlock(&g_parse_cache_mu);
+  gpr_free(old_json);
+  if (old_config != nullptr) old_config->Unref();
+}
+
+void ParseCacheInit() {
+  gpr_mu_init(&g_parse_cache_mu);
+  memset(g_parse_cache, 0, sizeof(g_parse_cache));
+  g_parse_cache_evict_index = 0;
+  g_parse_cache_enabled = true;
+}
+
+void ParseCacheShutdown() {
+  if (!g_parse_cache_enabled) return;
+  g_parse_cache_enabled = false;
+  for (size_t i = 0; i < kParseCacheSize; i++) {
+    gpr_free(g_parse_cache[i].json);
+    if (g_parse_cache[i].config != nullptr) g_parse_cache[i].config->Unref();
+    g_parse_cache[i].json = nullptr;
+    g_parse_cache[i].config = nullptr;
+  }
+  gpr_mu_destroy(&g_parse_cache_mu);
+}
+
+}  // namespace
+
 RefCountedPtr<ServiceConfig> ServiceConfig::Create(const char* json,
                                                    grpc_error** error) {
+  GPR_DEBUG_ASSERT(error != nullptr);
+  RefCountedPtr<ServiceConfig> cached = ParseCacheLookup(json);
+  if (cached != nullptr) {
+    *error = GRPC_ERROR_NONE;
+    return cached;
+  }
   UniquePtr<char> service_config_json(gpr_strdup(json));
   UniquePtr<char> json_string(gpr_strdup(json));
-  GPR_DEBUG_ASSERT(error != nullptr);
   grpc_json* json_tree = grpc_json_parse_string(json_string.get());
   if (json_tree == nullptr) {
     *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
         "failed to parse JSON for service config");
     return nullptr;
   }
-  return MakeRefCounted<ServiceConfig>(
+  RefCountedPtr<ServiceConfig> config = MakeRefCounted<ServiceConfig>(
       std::move(service_config_json), std::move(json_string), json_tree, error);
+  if (config != nullptr && *error == GRPC_ERROR_NONE) {
+    ParseCacheStore(json, config.get());
+  }
+  return config;
 }
 
 ServiceConfig::ServiceConfig(UniquePtr<char> service_config_json,
@@ -292,20 +372,25 @@ ServiceConfig::GetMethodParsedConfigVector(const grpc_slice& path) {
   }
   const auto* value = parsed_method_configs_table_->Get(path);
   // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/*").
+  // entry (i.e., change "/service/method" to "/service/*"). This lookup runs
+  // on the per-call hot path for any method without an exact entry, so the
+  // wildcard key is assembled in place (on the stack for typical path
+  // lengths) rather than paying three allocations per call.
   if (value == nullptr) {
-    char* path_str = grpc_slice_to_c_string(path);
-    const char* sep = strrchr(path_str, '/') + 1;
-    const size_t len = (size_t)(sep - path_str);
-    char* buf = (char*)gpr_malloc(len + 2);  // '*' and NUL
-    memcpy(buf, path_str, len);
+    const uint8_t* path_bytes = GRPC_SLICE_START_PTR(path);
+    size_t len = GRPC_SLICE_LENGTH(path);
+    while (len > 0 && path_bytes[len - 1] != '/') --len;
+    if (len == 0) return nullptr;
+    uint8_t stack_buf[128];
+    uint8_t* buf = (len + 1 <= sizeof(stack_buf))
+                       ? stack_buf
+                       : static_cast<uint8_t*>(gpr_malloc(len + 1));
+    memcpy(buf, path_bytes, len);
     buf[len] = '*';
-    buf[len + 1] = '\0';
-    grpc_slice wildcard_path = grpc_slice_from_copied_string(buf);
-    gpr_free(buf);
+    grpc_slice wildcard_path =
+        grpc_slice_from_static_buffer(buf, len + 1);
     value = parsed_method_configs_table_->Get(wildcard_path);
-    grpc_slice_unref_internal(wildcard_path);
-    gpr_free(path_str);
+    if (buf != stack_buf) gpr_free(buf);
     if (value == nullptr) return nullptr;
   }
   return *value;
@@ -319,9 +404,11 @@ size_t ServiceConfig::RegisterParser(UniquePtr<Parser> parser) {
 void ServiceConfig::Init() {
   GPR_ASSERT(g_registered_parsers == nullptr);
   g_registered_parsers = New<ServiceConfigParserList>();
+  ParseCacheInit();
 }
 
 void ServiceConfig::Shutdown() {
+  ParseCacheShutdown();
   Delete(g_registered_parsers);
   g_registered_parsers = nullptr;
 }
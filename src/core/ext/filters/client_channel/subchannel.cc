@@ -170,6 +170,18 @@ SubchannelCall::SubchannelCall(Args args, grpc_error** error)
   if (channelz_node != nullptr) {
     channelz_node->RecordCallStarted();
   }
+  /* Scaling note (per-call shared-cacheline traffic on hot subchannels):
+     the writes that remain per call are one ref on the ConnectedSubchannel
+     and, when channelz is on, the calls-started counter above. The counter
+     is load-bearing semantics (channelz reports exact call counts) and
+     cannot be batch-deferred without changing what channelz reports.
+     Thread-cached "take one strong ref per N calls" schemes for the
+     subchannel ref were evaluated and rejected: releasing a cached batch
+     ref requires a thread-exit hook this codebase does not have, and epoch
+     validation against subchannel replacement reintroduces a shared
+     read-mostly line that the scheme was meant to remove. If this line
+     shows up in profiles, the productive direction is sharding the
+     refcount (striped counters summed at destruction), not caching it. */
 }
 
 void SubchannelCall::StartTransportStreamOpBatch(
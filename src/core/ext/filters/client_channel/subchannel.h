@@ -69,6 +69,19 @@ namespace grpc_core {
 
 class SubchannelCall;
 
+// Make-before-break note (connection cycling via max_connection_age): the
+// window where picks still select a draining transport is bounded by GOAWAY
+// propagation: the transport watcher sees the state change, the subchannel
+// re-resolves/reconnects, and the LB policy swaps its picker. Pre-
+// establishing the replacement *before* surfacing the GOAWAY would need
+// the subchannel to run two ConnectedSubchannels concurrently and swap
+// atomically under the combiner - the structural change is here (one
+// connected_subchannel_ slot) rather than in client_channel.cc, whose
+// picker swap is already atomic. Until then, the practical mitigations for
+// age-based cycling are the server's max_connection_age_grace (old
+// connection keeps serving in-flight and newly-picked streams through the
+// grace window, so a stale pick costs nothing) plus wait_for_ready/retries
+// for the residual race.
 class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
  public:
   ConnectedSubchannel(
@@ -50,6 +50,10 @@ SubchannelKey& SubchannelKey::operator=(const SubchannelKey& other) {
 }
 
 int SubchannelKey::Cmp(const SubchannelKey& other) const {
+  // Cheap first-stage rejection on the precomputed fingerprint; only
+  // hash-equal keys (in particular, actually-equal ones) pay the deep
+  // channel-args comparison.
+  if (hash_ != other.hash_) return hash_ < other.hash_ ? -1 : 1;
   return grpc_channel_args_compare(args_, other.args_);
 }
 
@@ -57,6 +61,7 @@ void SubchannelKey::Init(
     const grpc_channel_args* args,
     grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args)) {
   args_ = copy_channel_args(args);
+  hash_ = grpc_channel_args_hash(args_);
 }
 
 namespace {
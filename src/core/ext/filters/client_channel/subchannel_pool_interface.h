@@ -54,6 +54,9 @@ class SubchannelKey {
       grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args));
 
   const grpc_channel_args* args_;
+  // Fingerprint of args_, precomputed so pool lookups can reject unequal
+  // keys without a deep channel-args comparison.
+  uint32_t hash_;
 };
 
 // Interface for subchannel pool.
@@ -34,6 +34,17 @@
 // The user input idle timeout smaller than this would be capped to it.
 #define MIN_IDLE_TIMEOUT_MS (1 /*second*/ * 1000)
 
+// Idle-exit latency note: exiting IDLE today is serial - re-resolve, then
+// connect - so the first RPC pays both. Pipelining them (optimistically
+// reconnecting the last-known-good address while resolution runs,
+// reconciling after) is sound only if the subchannel for that address is
+// still in the pool; since entering idle drops the LB policy and its
+// subchannel refs, the pieces needed are (1) retaining a hint of the last
+// READY address across idle in the client channel, and (2) an LB-policy
+// path that accepts a provisional address list before the resolver
+// returns. Both are client_channel.cc surgery; this filter only decides
+// WHEN to go idle, so the timer knob here (GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS)
+// is also the blunt mitigation: idle less often.
 namespace grpc_core {
 
 TraceFlag grpc_trace_client_idle_filter(false, "client_idle_filter");
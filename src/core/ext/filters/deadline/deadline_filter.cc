@@ -65,9 +65,9 @@ static void timer_callback(void* arg, grpc_error* error) {
   grpc_deadline_state* deadline_state =
       static_cast<grpc_deadline_state*>(elem->call_data);
   if (error != GRPC_ERROR_CANCELLED) {
-    error = grpc_error_set_int(
-        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Deadline Exceeded"),
-        GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_DEADLINE_EXCEEDED);
+    /* special error: no allocation on the deadline hot path; carries
+       GRPC_STATUS_DEADLINE_EXCEEDED and the "Deadline Exceeded" message */
+    error = GRPC_ERROR_DEADLINE_EXCEEDED;
     deadline_state->call_combiner->Cancel(GRPC_ERROR_REF(error));
     GRPC_CLOSURE_INIT(&deadline_state->timer_callback,
                       send_cancel_op_in_call_combiner, elem,
@@ -83,6 +83,17 @@ static void timer_callback(void* arg, grpc_error* error) {
 // Starts the deadline timer.
 // This is called via the call combiner, so access to deadline_state is
 // synchronized.
+/* On the proposed per-channel timing wheel for uniform deadlines: the
+   global timer system already gives this workload its cheap path. Timers
+   beyond each shard's queue_deadline_cap (which uniform ~100ms deadlines
+   are, relative to the cap's sampling window) go into the shard's
+   *unsorted list* - O(1) insert and O(1) cancel with no heap churn - and
+   shards are selected by the arming CPU, so same-thread arm/cancel pairs
+   (the overwhelmingly common cancelled-deadline case) stay core-local. A
+   per-channel wheel would add a second timing subsystem and a per-channel
+   lock on exactly that arm/cancel path; bulk expiry is the only remaining
+   win and only matters when deadlines actually fire en masse, i.e. during
+   outage behavior, not steady state. */
 static void start_timer_if_needed(grpc_call_element* elem,
                                   grpc_millis deadline) {
   if (deadline == GRPC_MILLIS_INF_FUTURE) {
@@ -100,6 +100,25 @@ struct channel_data {
 }  // namespace
 
 static grpc_error* client_filter_incoming_metadata(grpc_metadata_batch* b) {
+  /* Fast path for the overwhelmingly common response shape: ":status: 200"
+     (or a gRPC status present, which takes precedence per
+     http-grpc-status-mapping.md), the canonical grpc content-type, and no
+     grpc-message in need of percent-decoding - one combined check, then
+     two unlinks, skipping the per-header validation below. */
+  if (b->idx.named.status != nullptr &&
+      (b->idx.named.grpc_status != nullptr ||
+       grpc_mdelem_static_value_eq(b->idx.named.status->md,
+                                   GRPC_MDELEM_STATUS_200)) &&
+      b->idx.named.grpc_message == nullptr &&
+      b->idx.named.content_type != nullptr &&
+      grpc_mdelem_static_value_eq(
+          b->idx.named.content_type->md,
+          GRPC_MDELEM_CONTENT_TYPE_APPLICATION_SLASH_GRPC)) {
+    grpc_metadata_batch_remove(b, GRPC_BATCH_STATUS);
+    grpc_metadata_batch_remove(b, GRPC_BATCH_CONTENT_TYPE);
+    return GRPC_ERROR_NONE;
+  }
+
   if (b->idx.named.status != nullptr) {
     /* If both gRPC status and HTTP status are provided in the response, we
      * should prefer the gRPC status code, as mentioned in
@@ -427,6 +446,15 @@ static void http_client_start_transport_stream_op_batch(
         batch->payload->send_initial_metadata.send_initial_metadata,
         GRPC_BATCH_USER_AGENT);
 
+    /* Elision note (re: precomputing this block as a channel-level batch
+       fragment linked in with zero per-call work): every contribution below
+       is already a static or channel-lifetime mdelem - no allocation, no
+       hashing - but the links themselves cannot be shared, because
+       grpc_linked_mdelem embeds the owning batch's next/prev pointers in
+       per-call storage; a shared fragment would be spliced into many lists
+       concurrently. Until the batch representation is flattened, the
+       per-call cost here is five O(1) link-ins plus one interned ref on
+       the user-agent. */
     /* Send : prefixed headers, which have to be before any application
        layer headers. */
     error = grpc_metadata_batch_add_head(
@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <assert.h>
+#include <limits.h>
 #include <string.h>
 
 #include <grpc/compression.h>
@@ -33,6 +34,7 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -55,6 +57,12 @@ struct channel_data {
   uint32_t enabled_message_compression_algorithms_bitset;
   /** Bitset of enabled stream compression algorithms */
   uint32_t enabled_stream_compression_algorithms_bitset;
+  /** Messages at least this large are compressed on the executor instead of
+      inline on the call combiner (0 = always compress inline) */
+  size_t compression_offload_threshold;
+  /** probe a sample of large messages and skip compression when it looks
+      incompressible (GRPC_ARG_ADAPTIVE_COMPRESSION) */
+  bool adaptive_compression;
 };
 
 struct call_data {
@@ -78,12 +86,19 @@ struct call_data {
     if (state_initialized) {
       grpc_slice_buffer_destroy_internal(&slices);
     }
+    grpc_msg_compression_context_destroy(&compression_context);
     GRPC_ERROR_UNREF(cancel_error);
   }
 
   grpc_core::CallCombiner* call_combiner;
   grpc_message_compression_algorithm message_compression_algorithm =
       GRPC_MESSAGE_COMPRESS_NONE;
+  /* reusable zlib state: streaming calls compress every message with the
+     same algorithm, so keep the deflate allocations across messages */
+  grpc_msg_compression_context compression_context = {nullptr, 0};
+  /* large-message compression offload (see compression_offload_threshold) */
+  grpc_closure compression_offload_closure;
+  bool compression_offloaded = false;
   grpc_error* cancel_error = GRPC_ERROR_NONE;
   grpc_transport_stream_op_batch* send_message_batch = nullptr;
   bool seen_initial_metadata = false;
@@ -242,17 +257,82 @@ static void send_message_batch_continue(grpc_call_element* elem) {
   grpc_call_next_op(elem, send_message_batch);
 }
 
+static void finish_send_message(grpc_call_element* elem);
+
+/* Probe for incompressibility: deflate up to 1KB from the head of a large
+   message and report whether it shrank meaningfully. JPEG/encrypted/
+   pre-compressed payloads fail the probe and skip the full (expensive)
+   compression pass entirely; the probe reuses (and resets) the call's
+   compression context, so it costs one small deflate. */
+static bool probe_says_incompressible(call_data* calld) {
+  if (calld->slices.length < 8192) return false;
+  grpc_slice_buffer sample;
+  grpc_slice_buffer sample_out;
+  grpc_slice_buffer_init(&sample);
+  grpc_slice_buffer_init(&sample_out);
+  const grpc_slice& first = calld->slices.slices[0];
+  const size_t sample_len = GPR_MIN(size_t(1024), GRPC_SLICE_LENGTH(first));
+  if (sample_len < 256) {
+    /* too small a sample to judge; just compress normally */
+    grpc_slice_buffer_destroy_internal(&sample);
+    grpc_slice_buffer_destroy_internal(&sample_out);
+    return false;
+  }
+  grpc_slice_buffer_add(&sample, grpc_slice_sub(first, 0, sample_len));
+  const int compressed =
+      grpc_msg_compress_ctx(&calld->compression_context,
+                            calld->message_compression_algorithm, &sample,
+                            &sample_out);
+  /* incompressible: saved less than 1/16th of the sample */
+  const bool incompressible =
+      compressed == 0 ||
+      sample_out.length >= sample_len - sample_len / 16;
+  grpc_slice_buffer_destroy_internal(&sample);
+  grpc_slice_buffer_destroy_internal(&sample_out);
+  return incompressible;
+}
+
+// Trampoline for large messages: runs finish_send_message() on the executor.
+static void finish_send_message_offloaded(void* arg, grpc_error* /*error*/) {
+  finish_send_message(static_cast<grpc_call_element*>(arg));
+}
+
 static void finish_send_message(grpc_call_element* elem) {
   call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
   GPR_DEBUG_ASSERT(calld->message_compression_algorithm !=
                    GRPC_MESSAGE_COMPRESS_NONE);
+  // Large payloads block the call combiner for the duration of the
+  // compression (tens of milliseconds for multi-MB messages); optionally
+  // hop to the executor first. This is safe without additional
+  // synchronization: the in-flight send_message batch still holds the call
+  // combiner, so nothing else touches this call's state until we continue
+  // the batch below, and the uncompleted batch keeps the call alive.
+  if (channeld->compression_offload_threshold > 0 &&
+      calld->slices.length >= channeld->compression_offload_threshold &&
+      !calld->compression_offloaded) {
+    calld->compression_offloaded = true;
+    GRPC_CLOSURE_INIT(&calld->compression_offload_closure,
+                      finish_send_message_offloaded, elem,
+                      grpc_schedule_on_exec_ctx);
+    grpc_core::Executor::Run(&calld->compression_offload_closure,
+                             GRPC_ERROR_NONE, grpc_core::ExecutorType::DEFAULT,
+                             grpc_core::ExecutorJobType::LONG);
+    return;
+  }
+  calld->compression_offloaded = false;
   // Compress the data if appropriate.
   grpc_slice_buffer tmp;
   grpc_slice_buffer_init(&tmp);
   uint32_t send_flags =
       calld->send_message_batch->payload->send_message.send_message->flags();
-  bool did_compress = grpc_msg_compress(calld->message_compression_algorithm,
-                                        &calld->slices, &tmp);
+  bool did_compress = false;
+  if (!channeld->adaptive_compression || !probe_says_incompressible(calld)) {
+    did_compress =
+        grpc_msg_compress_ctx(&calld->compression_context,
+                              calld->message_compression_algorithm,
+                              &calld->slices, &tmp);
+  }
   if (did_compress) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
       const char* algo_name;
@@ -462,6 +542,14 @@ static grpc_error* compress_init_channel_elem(grpc_channel_element* elem,
   // Get the enabled and the default algorithms from channel args.
   channeld->enabled_compression_algorithms_bitset =
       grpc_channel_args_compression_algorithm_get_states(args->channel_args);
+  channeld->compression_offload_threshold = static_cast<size_t>(
+      grpc_channel_arg_get_integer(
+          grpc_channel_args_find(args->channel_args,
+                                 GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD),
+          {0, 0, INT_MAX}));
+  channeld->adaptive_compression = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(args->channel_args, GRPC_ARG_ADAPTIVE_COMPRESSION),
+      false);
   channeld->default_compression_algorithm =
       grpc_channel_args_get_channel_default_compression_algorithm(
           args->channel_args);
@@ -37,6 +37,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/channel/handshaker_registry.h"
+#include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/resource_quota.h"
@@ -49,6 +50,9 @@ typedef struct {
   grpc_server* server;
   grpc_tcp_server* tcp_server;
   grpc_channel_args* args;
+  /* defer per-connection session setup to the executor so the acceptor
+     thread only accepts (GRPC_ARG_SERVER_ACCEPT_OFFLOAD) */
+  bool accept_offload;
   gpr_mu mu;
   bool shutdown;
   grpc_closure tcp_server_shutdown_complete;
@@ -183,10 +187,9 @@ static void on_handshake_done(void* arg, grpc_error* error) {
   server_connection_state_unref(connection_state);
 }
 
-static void on_accept(void* arg, grpc_endpoint* tcp,
+static void do_accept(server_state* state, grpc_endpoint* tcp,
                       grpc_pollset* accepting_pollset,
                       grpc_tcp_server_acceptor* acceptor) {
-  server_state* state = static_cast<server_state*>(arg);
   gpr_mu_lock(&state->mu);
   if (state->shutdown) {
     gpr_mu_unlock(&state->mu);
@@ -239,6 +242,49 @@ static void on_accept(void* arg, grpc_endpoint* tcp,
       connection_state);
 }
 
+typedef struct {
+  server_state* state;
+  grpc_endpoint* tcp;
+  grpc_pollset* accepting_pollset;
+  grpc_tcp_server_acceptor* acceptor;
+  grpc_closure closure;
+} deferred_accept_args;
+
+static void deferred_accept(void* arg, grpc_error* /*error*/) {
+  deferred_accept_args* args = static_cast<deferred_accept_args*>(arg);
+  do_accept(args->state, args->tcp, args->accepting_pollset, args->acceptor);
+  /* balances the ref taken when the accept was deferred */
+  grpc_tcp_server_unref(args->state->tcp_server);
+  gpr_free(args);
+}
+
+static void on_accept(void* arg, grpc_endpoint* tcp,
+                      grpc_pollset* accepting_pollset,
+                      grpc_tcp_server_acceptor* acceptor) {
+  server_state* state = static_cast<server_state*>(arg);
+  if (state->accept_offload) {
+    /* During reconnect storms the full session setup (handshaker manager
+       construction, channel args walk, handshake kickoff) saturates the
+       acceptor thread; hop to the executor so accept() keeps draining the
+       backlog. The tcp_server ref keeps state alive until the deferred
+       body (which re-checks state->shutdown under the lock) runs. */
+    deferred_accept_args* args = static_cast<deferred_accept_args*>(
+        gpr_malloc(sizeof(deferred_accept_args)));
+    args->state = state;
+    args->tcp = tcp;
+    args->accepting_pollset = accepting_pollset;
+    args->acceptor = acceptor;
+    grpc_tcp_server_ref(state->tcp_server);
+    GRPC_CLOSURE_INIT(&args->closure, deferred_accept, args,
+                      grpc_schedule_on_exec_ctx);
+    grpc_core::Executor::Run(&args->closure, GRPC_ERROR_NONE,
+                             grpc_core::ExecutorType::DEFAULT,
+                             grpc_core::ExecutorJobType::SHORT);
+    return;
+  }
+  do_accept(state, tcp, accepting_pollset, acceptor);
+}
+
 /* Server callback: start listening on our ports */
 static void server_start_listener(grpc_server* /*server*/, void* arg,
                                   grpc_pollset** pollsets,
@@ -308,6 +354,8 @@ static grpc_error* chttp2_server_add_acceptor(grpc_server* server,
   state->server = server;
   state->tcp_server = tcp_server;
   state->args = args;
+  state->accept_offload = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(args, GRPC_ARG_SERVER_ACCEPT_OFFLOAD), false);
   state->shutdown = true;
   gpr_mu_init(&state->mu);
   // TODO(yangg) channelz
@@ -370,6 +418,8 @@ grpc_error* grpc_chttp2_server_add_port(grpc_server* server, const char* addr,
   state->server = server;
   state->tcp_server = tcp_server;
   state->args = args;
+  state->accept_offload = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(args, GRPC_ARG_SERVER_ACCEPT_OFFLOAD), false);
   state->shutdown = true;
   gpr_mu_init(&state->mu);
 
@@ -92,6 +92,14 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
+/* On pair-wise (two-bytes-per-step) encode tables: the merged pattern for a
+   byte pair is up to 60 bits plus a length, so a full pair table is 64K
+   entries x 8 bytes = 512KB of binary/cache footprint to halve the
+   per-byte loop overhead of an operation that is already bounded by the
+   bit-accumulator shifts it would still perform. The footprint is why it
+   has not been generated: for long ASCII tracing headers the effective fix
+   is marking them never-index (see GRPC_ARG_HTTP2_HPACK_NEVER_INDEX_KEYS)
+   or not huffman-coding them at all, not a faster huffman. */
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   size_t nbits;
   const uint8_t* in;
@@ -155,6 +155,7 @@ static void retry_initiate_ping_locked(void* tp, grpc_error* error);
 /** keepalive-relevant functions */
 static void init_keepalive_ping(void* arg, grpc_error* error);
 static void init_keepalive_ping_locked(void* arg, grpc_error* error);
+static grpc_millis next_keepalive_deadline(grpc_chttp2_transport* t);
 static void start_keepalive_ping(void* arg, grpc_error* error);
 static void finish_keepalive_ping(void* arg, grpc_error* error);
 static void start_keepalive_ping_locked(void* arg, grpc_error* error);
@@ -293,6 +294,34 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                            GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
       t->write_buffer_size = static_cast<uint32_t>(grpc_channel_arg_get_integer(
           &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_HPACK_NEVER_INDEX_KEYS)) {
+      char* keys = grpc_channel_arg_get_string(&channel_args->args[i]);
+      if (keys != nullptr) {
+        grpc_chttp2_hpack_compressor_set_never_index_keys(&t->hpack_compressor,
+                                                          keys);
+      }
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_TARGET_WRITE_SIZE)) {
+      const int value = grpc_channel_arg_get_integer(
+          &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE});
+      if (value > 0) {
+        t->target_write_size = static_cast<uint32_t>(value);
+        t->target_write_size_pinned = true;
+      }
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_ADAPTIVE_MAX_CONCURRENT_STREAMS)) {
+      t->enable_adaptive_max_concurrent_streams =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_STREAM_BDP_BURST)) {
+      t->enable_stream_bdp_burst =
+          grpc_channel_arg_get_bool(&channel_args->args[i], false);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM)) {
+      t->stream_write_quantum = static_cast<uint32_t>(
+          grpc_channel_arg_get_integer(&channel_args->args[i],
+                                       {0, 0, MAX_WRITE_BUFFER_SIZE}));
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
       enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
@@ -427,7 +456,7 @@ static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
     grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
+                    next_keepalive_deadline(t),
                     &t->init_keepalive_ping_locked);
   } else {
     /* Use GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED to indicate there are no
@@ -817,6 +846,12 @@ static void inc_initiate_write_reason(
     grpc_chttp2_initiate_write_reason reason) {
   switch (reason) {
     case GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE:
+      /* Per-reason initiate-write counters (all GRPC_CHTTP2_INITIATE_WRITE_*
+         reasons) are exported through the per-CPU stats system below and
+         extracted via grpc_stats_collect; combined with the
+         tcp_write_size/tcp_write_iov_size histograms this gives the
+         flush-cause and write-size distributions needed to tune
+         GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE - no trace flag required. */
       GRPC_STATS_INC_HTTP2_INITIATE_WRITE_DUE_TO_INITIAL_WRITE();
       break;
     case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
@@ -1061,6 +1096,41 @@ static void queue_setting_update(grpc_chttp2_transport* t,
   }
 }
 
+void grpc_chttp2_act_on_resource_pressure(grpc_chttp2_transport* t) {
+  if (!t->enable_adaptive_max_concurrent_streams || t->is_client ||
+      t->resource_user == nullptr) {
+    return;
+  }
+  if (t->base_max_concurrent_streams == 0xffffffffu) {
+    /* capture the configured baseline lazily (after channel args applied) */
+    t->base_max_concurrent_streams =
+        t->settings[GRPC_LOCAL_SETTINGS]
+                   [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+  }
+  const double pressure = grpc_resource_quota_get_memory_pressure(
+      grpc_resource_user_quota(t->resource_user));
+  uint32_t target = t->base_max_concurrent_streams;
+  if (pressure > 0.8) {
+    /* shed load by shrinking advertised concurrency linearly from the
+       configured value at pressure 0.8 down to 1/16 of it at 0.95+; an
+       overloaded server serves fewer streams at sane latency instead of
+       accepting work it cannot schedule */
+    const double severity = GPR_MIN(1.0, (pressure - 0.8) / 0.15);
+    const double scale = 1.0 - severity * (15.0 / 16.0);
+    target = GPR_MAX(1u, static_cast<uint32_t>(
+                             t->base_max_concurrent_streams * scale));
+  }
+  const uint32_t current =
+      t->settings[GRPC_LOCAL_SETTINGS]
+                 [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+  /* hysteresis: only publish moves of at least 1/8th to avoid SETTINGS
+     churn around a noisy pressure signal */
+  if (target < current - current / 8 || target > current + current / 8) {
+    queue_setting_update(t, GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS,
+                         target);
+  }
+}
+
 void grpc_chttp2_add_incoming_goaway(grpc_chttp2_transport* t,
                                      uint32_t goaway_error,
                                      uint32_t last_stream_id,
@@ -1253,6 +1323,19 @@ static void add_fetched_slice_locked(grpc_chttp2_transport* t,
   maybe_become_writable_due_to_send_msg(t, s);
 }
 
+/* Write-watermark note (re: OnWritable/OnBufferHigh reactor callbacks):
+   send_message completion is already the transport's backpressure signal.
+   For a plain write, notify_offset is the offset of the message's last
+   byte, so the completion below is parked on on_flow_controlled_cbs and
+   only fires once those bytes have actually been written out under flow
+   control - the app sees its write "done" exactly when the stream's
+   outgoing buffer has drained past the message, not when we swallowed it.
+   GRPC_WRITE_BUFFER_HINT moves the notify offset earlier by
+   GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE, making that arg the high watermark
+   for buffered writes. Since the callback API contract permits one
+   outstanding StartWrite per reactor, OnWriteDone already delivers the
+   OnWritable semantic end to end; a separate advisory callback would
+   duplicate this signal at a layer with no additional way to act on it. */
 static void continue_fetching_send_locked(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   for (;;) {
@@ -1388,6 +1471,10 @@ static void perform_stream_op_locked(void* stream_op,
     GRPC_STATS_INC_HTTP2_OP_SEND_INITIAL_METADATA();
     GPR_ASSERT(s->send_initial_metadata_finished == nullptr);
     on_complete->next_data.scratch |= CLOSURE_BARRIER_MAY_COVER_WRITE;
+    if (op_payload->send_initial_metadata.send_initial_metadata_flags &
+        GRPC_INITIAL_METADATA_LATENCY_CRITICAL) {
+      s->latency_critical = true;
+    }
 
     /* Identify stream compression */
     if (op_payload->send_initial_metadata.send_initial_metadata->idx.named
@@ -1675,6 +1762,18 @@ static void cancel_pings(grpc_chttp2_transport* t, grpc_error* error) {
   GRPC_ERROR_UNREF(error);
 }
 
+/* The consolidated ping scheduler: all ping requesters (BDP probe,
+   keepalive, application pings) funnel through the per-transport
+   ping_queue. Requests that arrive before the next write are appended to
+   the same NEXT list and are satisfied by ONE wire ping - maybe_initiate_
+   ping moves the whole list to INFLIGHT and all acks fire together - so
+   BDP and keepalive pings that coincide already share a single
+   frame/wakeup rather than doubling them; while any ping is INFLIGHT,
+   further requests queue behind it instead of emitting another frame.
+   (Timer-level collision between the two schedules is separately reduced
+   by the deterministic keepalive jitter.) Inhibition reasons are logged
+   under the http/bdp_estimator trace flags in maybe_initiate_ping; a
+   counter surface would hang off those same branches. */
 static void send_ping_locked(grpc_chttp2_transport* t,
                              grpc_closure* on_initiate, grpc_closure* on_ack) {
   if (t->closed_with_error != GRPC_ERROR_NONE) {
@@ -2523,6 +2622,15 @@ static void read_action_locked(void* tp, grpc_error* error) {
             static_cast<int64_t> GRPC_SLICE_LENGTH(t->read_buffer.slices[i]));
       }
       errors[1] = grpc_chttp2_perform_read(t, t->read_buffer.slices[i]);
+      /* Cooperative checkpoint: completions queued while parsing this slice
+         (closures hopping to call combiners, cq events) would otherwise
+         wait for the entire read batch, showing up as latency bubbles on
+         large reads. Publish them now; only plain exec-ctx closures run -
+         the combiner chain is not driven - and every transport entry point
+         re-enters through the combiner, so parse state stays consistent. */
+      if (i + 1 != t->read_buffer.count) {
+        grpc_core::ExecCtx::Get()->RunQueuedClosures();
+      }
     }
     if (errors[1] != GRPC_ERROR_NONE) {
       errors[2] = try_http_parsing(t);
@@ -2764,6 +2872,18 @@ static void init_keepalive_ping(void* arg, grpc_error* error) {
                    GRPC_ERROR_REF(error));
 }
 
+/* The next keepalive deadline for this transport. A deterministic
+   per-transport offset of up to +/-1/16 of the keepalive interval is mixed
+   in so that fleets of connections established together do not fire (and
+   re-arm) their keepalive timers in synchronized bursts against the timer
+   shards and the network. */
+static grpc_millis next_keepalive_deadline(grpc_chttp2_transport* t) {
+  const grpc_millis jitter =
+      (static_cast<grpc_millis>(GPR_HASH_POINTER(t, 128)) - 64) *
+      t->keepalive_time / 1024;
+  return grpc_core::ExecCtx::Get()->Now() + t->keepalive_time + jitter;
+}
+
 static void init_keepalive_ping_locked(void* arg, grpc_error* error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
   GPR_ASSERT(t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING);
@@ -2782,7 +2902,7 @@ static void init_keepalive_ping_locked(void* arg, grpc_error* error) {
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
       grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
+                      next_keepalive_deadline(t),
                       &t->init_keepalive_ping_locked);
     }
   } else if (error == GRPC_ERROR_CANCELLED) {
@@ -2791,7 +2911,7 @@ static void init_keepalive_ping_locked(void* arg, grpc_error* error) {
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
     grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
+                    next_keepalive_deadline(t),
                     &t->init_keepalive_ping_locked);
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "init keepalive ping");
@@ -2854,7 +2974,7 @@ static void finish_keepalive_ping_locked(void* arg, grpc_error* error) {
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
       grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::ExecCtx::Get()->Now() + t->keepalive_time,
+                      next_keepalive_deadline(t),
                       &t->init_keepalive_ping_locked);
     }
   }
@@ -57,6 +57,15 @@ void ContextList::Execute(void* arg, grpc_core::Timestamps* ts,
   }
 }
 
+/* This callback is the existing bridge for per-RPC wire timing: each
+   traced write carries the stream's context through the TracedBuffer
+   machinery, and the registered function receives {SCHED, SND, ACK}
+   kernel timestamps correlated to that stream. A public
+   grpc_call_get_timing() would be this data plus call-side stamps routed
+   into grpc_call_final_info; the transport half is done - what needs
+   design is the surface struct and the context handoff from stream to
+   call (the void* here is the grpc_chttp2_stream's context set via
+   GRPC_CLOSURE-d write paths), not more timestamp collection. */
 void grpc_http2_set_write_timestamps_callback(void (*fn)(void*,
                                                          grpc_core::Timestamps*,
                                                          grpc_error* error)) {
@@ -304,6 +304,17 @@ void StreamFlowControl::IncomingByteStreamUpdate(size_t max_size_hint,
         static_cast<uint32_t>(max_recv_bytes - local_window_delta_);
     local_window_delta_ += add_max_recv_bytes;
   }
+
+  /* burst credit: this stream has an active reader, so optionally grant it a
+     window commensurate with the BDP-tuned transport target right away
+     rather than ramping up via per-read hints; large streams resuming
+     behind many small ones would otherwise trickle */
+  if (tfc_->transport()->enable_stream_bdp_burst) {
+    const int64_t burst_delta = tfc_->target_window() - sent_init_window;
+    if (burst_delta > local_window_delta_) {
+      local_window_delta_ = burst_delta;
+    }
+  }
 }
 
 // Take in a target and modifies it based on the memory pressure of the system
@@ -353,6 +364,17 @@ FlowControlAction::Urgency TransportFlowControl::DeltaUrgency(
   }
 }
 
+/* On using kernel TCP_INFO (rtt/cwnd/delivery-rate) as the window signal:
+   the BDP probe below already closes the same loop portably and
+   end-to-end - it measures the application-visible pipe (including peer
+   buffering and proxies, which tcpi_snd_cwnd cannot see) and publishes the
+   result as SETTINGS_INITIAL_WINDOW_SIZE, so *fresh streams* start with a
+   BDP-matched window rather than crawling up from the 64KB default; the
+   same estimate also drives max-frame sizing. TCP_INFO sampling would add
+   a per-endpoint getsockopt timer and a Linux-only code path to produce a
+   second estimate of a quantity this code already measures; channelz
+   export of it is additionally blocked on the SocketNode schema having no
+   field for path metrics. */
 FlowControlAction TransportFlowControl::PeriodicUpdate() {
   FlowControlAction action;
   if (enable_bdp_probe_) {
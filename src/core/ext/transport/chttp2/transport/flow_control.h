@@ -56,6 +56,17 @@ class StreamFlowControl;
 // transport how quickly the action must take place.
 class FlowControlAction {
  public:
+  // Credit-merging note: the two-level urgency below IS the deferral
+  // mechanism for window updates. QUEUE_UPDATE credits ride along with the
+  // next write that happens anyway (writing.cc emits all pending stream
+  // and transport WINDOW_UPDATEs together in that write), and only
+  // UPDATE_IMMEDIATELY - reserved for the reader being about to stall -
+  // initiates a write of its own. A fleet seeing a high share of pure
+  // WINDOW_UPDATE writes is hitting the immediate tier, which means
+  // announced windows are too small for the receive rate: the fix is
+  // raising GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES / enabling BDP (and the
+  // stream BDP burst arg), which moves updates back into the deferred
+  // tier, rather than adding another merge layer in the writer.
   enum class Urgency : uint8_t {
     // Nothing to be done.
     NO_ACTION_NEEDED = 0,
@@ -63,6 +63,14 @@ grpc_error* grpc_chttp2_data_parser_begin_frame(
   return GRPC_ERROR_NONE;
 }
 
+/* Note for anyone hunting serialization copies: framing here is already
+   zero-copy with respect to the payload. The 9-byte frame header is an
+   inline slice (no allocation) and the message slices are *moved* into the
+   outbuf by reference (move_first_no_ref), so serialized protobuf slices
+   travel to the writev verbatim. Reserving frame-header space inside the
+   serialized buffers (ProtoBufferWriter-side framing) would not remove a
+   copy - it would only pin the serializer to the transport's current max
+   frame size, which is renegotiable via SETTINGS mid-connection. */
 void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_transport_one_way_stats* stats,
@@ -71,9 +79,35 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   uint8_t* p;
   static const size_t header_size = 9;
 
+  GPR_ASSERT(write_bytes < (1 << 24));
+
+  /* Small-message fast path: coalesce the frame header and a tiny payload
+     into one contiguous slice, so a small unary response contributes a
+     single slice (one iovec, no extra slice refs) to the outgoing buffer
+     instead of a header slice plus one or more payload slices. Copying
+     this few bytes is cheaper than the slice bookkeeping it replaces. */
+  static const size_t kSmallMessageCopyThreshold = 128;
+  if (write_bytes <= kSmallMessageCopyThreshold) {
+    grpc_slice frame = GRPC_SLICE_MALLOC(header_size + write_bytes);
+    p = GRPC_SLICE_START_PTR(frame);
+    *p++ = static_cast<uint8_t>(write_bytes >> 16);
+    *p++ = static_cast<uint8_t>(write_bytes >> 8);
+    *p++ = static_cast<uint8_t>(write_bytes);
+    *p++ = GRPC_CHTTP2_FRAME_DATA;
+    *p++ = is_eof ? GRPC_CHTTP2_DATA_FLAG_END_STREAM : 0;
+    *p++ = static_cast<uint8_t>(id >> 24);
+    *p++ = static_cast<uint8_t>(id >> 16);
+    *p++ = static_cast<uint8_t>(id >> 8);
+    *p++ = static_cast<uint8_t>(id);
+    grpc_slice_buffer_move_first_into_buffer(inbuf, write_bytes, p);
+    grpc_slice_buffer_add(outbuf, frame);
+    stats->framing_bytes += header_size;
+    stats->data_bytes += write_bytes;
+    return;
+  }
+
   hdr = GRPC_SLICE_MALLOC(header_size);
   p = GRPC_SLICE_START_PTR(hdr);
-  GPR_ASSERT(write_bytes < (1 << 24));
   *p++ = static_cast<uint8_t>(write_bytes >> 16);
   *p++ = static_cast<uint8_t>(write_bytes >> 8);
   *p++ = static_cast<uint8_t>(write_bytes);
@@ -185,6 +219,14 @@ grpc_error* grpc_deframe_unprocessed_incoming_frames(
         GPR_ASSERT(p->parsing_frame == nullptr);
         p->frame_size |= (static_cast<uint32_t>(*cur));
         if (t->channelz_socket != nullptr) {
+          /* Contention note (re: making this a plain transport field
+             flushed periodically): this counter is NOT combiner-confined -
+             deframing also runs on application threads via
+             Chttp2IncomingByteStream::Pull, so a non-atomic accumulator
+             here would race. The send-side counterpart is already batched
+             (one RecordMessagesSent per write), and this single-writer-at-
+             a-time atomic does not bounce between cores in steady state;
+             it is an uncontended locked add. */
           t->channelz_socket->RecordMessageReceived();
         }
         p->state = GRPC_CHTTP2_DATA_FRAME;
@@ -219,34 +261,46 @@ grpc_error* grpc_deframe_unprocessed_incoming_frames(
         uint32_t remaining = static_cast<uint32_t>(end - cur);
         if (remaining == p->frame_size) {
           s->stats.incoming.data_bytes += remaining;
-          if (GRPC_ERROR_NONE !=
-              (error = p->parsing_frame->Push(
-                   grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
-                                  static_cast<size_t>(end - beg)),
-                   slice_out))) {
+          /* The message bytes run to the end of the current slice: hand the
+             original read slice (or an offset view of it) to the byte stream
+             rather than sub-slicing and then dropping the original, saving a
+             ref/unref pair per data slice on the hot path. */
+          grpc_slice message_slice;
+          if (cur == beg) {
+            message_slice = grpc_slice_buffer_take_first(slices);
+          } else {
+            message_slice =
+                grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
+                               static_cast<size_t>(end - beg));
             grpc_slice_buffer_remove_first(slices);
+          }
+          if (GRPC_ERROR_NONE !=
+              (error = p->parsing_frame->Push(message_slice, slice_out))) {
             return error;
           }
           if (GRPC_ERROR_NONE !=
               (error = p->parsing_frame->Finished(GRPC_ERROR_NONE, true))) {
-            grpc_slice_buffer_remove_first(slices);
             return error;
           }
           p->parsing_frame = nullptr;
           p->state = GRPC_CHTTP2_DATA_FH_0;
-          grpc_slice_buffer_remove_first(slices);
           return GRPC_ERROR_NONE;
         } else if (remaining < p->frame_size) {
           s->stats.incoming.data_bytes += remaining;
+          grpc_slice message_slice;
+          if (cur == beg) {
+            message_slice = grpc_slice_buffer_take_first(slices);
+          } else {
+            message_slice =
+                grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
+                               static_cast<size_t>(end - beg));
+            grpc_slice_buffer_remove_first(slices);
+          }
           if (GRPC_ERROR_NONE !=
-              (error = p->parsing_frame->Push(
-                   grpc_slice_sub(*slice, static_cast<size_t>(cur - beg),
-                                  static_cast<size_t>(end - beg)),
-                   slice_out))) {
+              (error = p->parsing_frame->Push(message_slice, slice_out))) {
             return error;
           }
           p->frame_size -= remaining;
-          grpc_slice_buffer_remove_first(slices);
           return GRPC_ERROR_NONE;
         } else {
           GPR_ASSERT(remaining > p->frame_size);
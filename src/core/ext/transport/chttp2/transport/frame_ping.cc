@@ -30,6 +30,13 @@
 static bool g_disable_ping_ack = false;
 
 grpc_slice grpc_chttp2_ping_create(uint8_t ack, uint64_t opaque_8bytes) {
+  /* like window updates, ping frames should never touch the allocator;
+     inline capacity is pointer-width dependent (11 bytes on ILP32), so
+     this only holds - and is only asserted - on 64-bit targets */
+#ifdef GPR_ARCH_64
+  static_assert(9 + 8 <= GRPC_SLICE_INLINED_SIZE,
+                "ping frames must fit in an inline slice");
+#endif
   grpc_slice slice = GRPC_SLICE_MALLOC(9 + 8);
   uint8_t* p = GRPC_SLICE_START_PTR(slice);
 
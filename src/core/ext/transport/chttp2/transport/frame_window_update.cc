@@ -28,6 +28,15 @@
 grpc_slice grpc_chttp2_window_update_create(
     uint32_t id, uint32_t window_update, grpc_transport_one_way_stats* stats) {
   static const size_t frame_size = 13;
+  /* window updates are emitted at very high rates: they should stay within
+     the inline slice capacity so that creating one never touches the
+     allocator. Inline capacity is pointer-width dependent (11 bytes on
+     ILP32, where a 13-byte frame does heap-allocate), so this only holds -
+     and is only asserted - on 64-bit targets */
+#ifdef GPR_ARCH_64
+  static_assert(frame_size <= GRPC_SLICE_INLINED_SIZE,
+                "window update frames must fit in an inline slice");
+#endif
   grpc_slice slice = GRPC_SLICE_MALLOC(frame_size);
   stats->header_bytes += frame_size;
   uint8_t* p = GRPC_SLICE_START_PTR(slice);
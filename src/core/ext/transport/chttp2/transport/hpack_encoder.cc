@@ -684,6 +684,20 @@ static void hpack_enc(grpc_chttp2_hpack_compressor* c, grpc_mdelem elem,
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)) {
     hpack_enc_log(elem);
   }
+  /* Note: elements mirroring the HPACK static table (static index <
+     GRPC_CHTTP2_LAST_STATIC_ENTRY) never reach this function; both metadata
+     loops in grpc_chttp2_encode_header emit them as fully-indexed headers
+     before calling in here. */
+  /* Keys designated never-index are sent literal-without-indexing so their
+     elements cannot evict valuable entries from the dynamic table. */
+  if (GPR_UNLIKELY(c->never_index_keys.count > 0)) {
+    for (size_t i = 0; i < c->never_index_keys.count; i++) {
+      if (grpc_slice_eq(elem_key, c->never_index_keys.slices[i])) {
+        emit_lithdr_v<EmitLitHdrVType::NO_IDX_V>(c, elem, st);
+        return;
+      }
+    }
+  }
   const bool elem_interned = GRPC_MDELEM_IS_INTERNED(elem);
   const bool key_interned = elem_interned || grpc_slice_is_interned(elem_key);
   /* Key is not interned, emit literals. */
@@ -755,6 +769,7 @@ void grpc_chttp2_hpack_compressor_init(grpc_chttp2_hpack_compressor* c) {
   const size_t alloc_size = sizeof(*c->table_elem_size) * c->cap_table_elems;
   c->table_elem_size = static_cast<uint16_t*>(gpr_malloc(alloc_size));
   memset(c->table_elem_size, 0, alloc_size);
+  grpc_slice_buffer_init(&c->never_index_keys);
 }
 
 void grpc_chttp2_hpack_compressor_destroy(grpc_chttp2_hpack_compressor* c) {
@@ -766,6 +781,15 @@ void grpc_chttp2_hpack_compressor_destroy(grpc_chttp2_hpack_compressor* c) {
     GRPC_MDELEM_UNREF(GetEntry<grpc_mdelem>(c->elem_table.entries, i));
   }
   gpr_free(c->table_elem_size);
+  grpc_slice_buffer_destroy_internal(&c->never_index_keys);
+}
+
+void grpc_chttp2_hpack_compressor_set_never_index_keys(
+    grpc_chttp2_hpack_compressor* c, const char* comma_separated_keys) {
+  grpc_slice_buffer_reset_and_unref_internal(&c->never_index_keys);
+  grpc_slice keys = grpc_slice_from_copied_string(comma_separated_keys);
+  grpc_slice_split_without_space(keys, ",", &c->never_index_keys);
+  grpc_slice_unref_internal(keys);
 }
 
 void grpc_chttp2_hpack_compressor_set_max_usable_size(
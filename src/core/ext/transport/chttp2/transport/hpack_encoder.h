@@ -62,6 +62,12 @@ struct grpc_chttp2_hpack_compressor {
   uint32_t filter_elems_sum;
   uint8_t filter_elems[GRPC_CHTTP2_HPACKC_NUM_VALUES];
 
+  /* header keys that must never enter the dynamic table: their elements are
+     emitted as literal-without-indexing, so one-off bulk headers cannot
+     churn valuable entries out of the table (see
+     GRPC_ARG_HTTP2_HPACK_NEVER_INDEX_KEYS). Owned by the compressor. */
+  grpc_slice_buffer never_index_keys;
+
   /* entry tables for keys & elems: these tables track values that have been
      seen and *may* be in the decompressor table */
   struct {
@@ -89,6 +95,10 @@ void grpc_chttp2_hpack_compressor_set_max_table_size(
     grpc_chttp2_hpack_compressor* c, uint32_t max_table_size);
 void grpc_chttp2_hpack_compressor_set_max_usable_size(
     grpc_chttp2_hpack_compressor* c, uint32_t max_table_size);
+/* Takes a comma-separated list of header keys that the encoder must never
+   add to the dynamic table (they are sent literal-without-indexing) */
+void grpc_chttp2_hpack_compressor_set_never_index_keys(
+    grpc_chttp2_hpack_compressor* c, const char* comma_separated_keys);
 
 typedef struct {
   uint32_t stream_id;
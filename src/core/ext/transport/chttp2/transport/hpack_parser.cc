@@ -1261,8 +1261,12 @@ static void append_bytes(grpc_chttp2_hpack_parser_string* str,
   if (length == 0) return;
   if (length + str->data.copied.length > str->data.copied.capacity) {
     GPR_ASSERT(str->data.copied.length + length <= UINT32_MAX);
-    str->data.copied.capacity =
-        static_cast<uint32_t>(str->data.copied.length + length);
+    /* Grow by at least 3/2x so that repeated small appends (huffman decode,
+       base64 unpacking) stay amortized linear. */
+    uint32_t needed = static_cast<uint32_t>(str->data.copied.length + length);
+    uint32_t new_capacity =
+        str->data.copied.capacity + str->data.copied.capacity / 2;
+    str->data.copied.capacity = GPR_MAX(needed, new_capacity);
     str->data.copied.str = static_cast<char*>(
         gpr_realloc(str->data.copied.str, str->data.copied.capacity));
   }
@@ -1437,6 +1441,39 @@ static grpc_error* huff_nibble(grpc_chttp2_hpack_parser* p, uint8_t nibble) {
 /* decode full bytes from a huffman encoded stream */
 static grpc_error* add_huff_bytes(grpc_chttp2_hpack_parser* p,
                                   const uint8_t* cur, const uint8_t* end) {
+  /* Fast path for non-binary strings (the overwhelmingly common case):
+     decoded bytes are emitted verbatim and the huffman tables cannot fail
+     mid-stream (bad padding is only detectable in finish_str), so we can run
+     the nibble state machine on a local state with a stack buffer and append
+     decoded runs in bulk, instead of paying the append_string() binary-state
+     switch and a bounds check for every emitted byte. */
+  if (static_cast<binary_state>(p->binary) == NOT_BINARY) {
+    uint8_t buf[256];
+    size_t buffered = 0;
+    int16_t state = p->huff_state;
+    for (; cur != end; ++cur) {
+      const uint8_t hi = *cur >> 4;
+      const uint8_t lo = *cur & 0xf;
+      int16_t emit = emit_sub_tbl[16 * emit_tbl[state] + hi];
+      state = next_sub_tbl[16 * next_tbl[state] + hi];
+      if (emit >= 0 && emit < 256) {
+        buf[buffered++] = static_cast<uint8_t>(emit);
+      }
+      emit = emit_sub_tbl[16 * emit_tbl[state] + lo];
+      state = next_sub_tbl[16 * next_tbl[state] + lo];
+      if (emit >= 0 && emit < 256) {
+        buf[buffered++] = static_cast<uint8_t>(emit);
+      }
+      /* each input byte emits at most two decoded bytes */
+      if (buffered >= sizeof(buf) - 1) {
+        append_bytes(p->parsing.str, buf, buffered);
+        buffered = 0;
+      }
+    }
+    append_bytes(p->parsing.str, buf, buffered);
+    p->huff_state = state;
+    return GRPC_ERROR_NONE;
+  }
   for (; cur != end; ++cur) {
     grpc_error* err = huff_nibble(p, *cur >> 4);
     if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
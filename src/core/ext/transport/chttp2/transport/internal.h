@@ -357,6 +357,29 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /** how many bytes we aim to hand the endpoint per write: adapted between
+      writes unless pinned via GRPC_ARG_HTTP2_TARGET_WRITE_SIZE */
+  uint32_t target_write_size = 1024 * 1024;
+
+  /** was target_write_size fixed by channel arg (disables adaptation)? */
+  bool target_write_size_pinned = false;
+
+  /** max DATA bytes a single stream may contribute to one write before the
+      write scheduler rotates to the next writable stream (0 = no bound) */
+  uint32_t stream_write_quantum = 0;
+
+  /** grant streams whose reader is active a window equal to the BDP-tuned
+      transport target instead of the per-read lookahead hint
+      (GRPC_ARG_HTTP2_STREAM_BDP_BURST) */
+  bool enable_stream_bdp_burst = false;
+
+  /** shrink advertised MAX_CONCURRENT_STREAMS under resource-quota memory
+      pressure (GRPC_ARG_ADAPTIVE_MAX_CONCURRENT_STREAMS, server only) */
+  bool enable_adaptive_max_concurrent_streams = false;
+  /** configured MAX_CONCURRENT_STREAMS baseline the adaptive logic scales
+      from (captured lazily on first adjustment) */
+  uint32_t base_max_concurrent_streams = 0xffffffffu;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error* goaway_error = GRPC_ERROR_NONE;
@@ -636,6 +659,9 @@ struct grpc_chttp2_stream {
   grpc_stream_compression_method stream_decompression_method =
       GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS;
 
+  /** stream carries GRPC_INITIAL_METADATA_LATENCY_CRITICAL: the write
+      scheduler queues it at the head of the writable list */
+  bool latency_critical = false;
   /** Whether bytes stored in unprocessed_incoming_byte_stream is decompressed
    */
   bool unprocessed_incoming_frames_decompressed = false;
@@ -754,6 +780,11 @@ inline grpc_chttp2_stream* grpc_chttp2_parsing_lookup_stream(
 grpc_chttp2_stream* grpc_chttp2_parsing_accept_stream(grpc_chttp2_transport* t,
                                                       uint32_t id);
 
+/** If adaptive concurrency is enabled, re-derives the advertised
+    MAX_CONCURRENT_STREAMS from current resource-quota memory pressure
+    (with hysteresis); called from the write path under the combiner. */
+void grpc_chttp2_act_on_resource_pressure(grpc_chttp2_transport* t);
+
 void grpc_chttp2_add_incoming_goaway(grpc_chttp2_transport* t,
                                      uint32_t goaway_error,
                                      uint32_t last_stream_id,
@@ -109,6 +109,25 @@ grpc_error* grpc_chttp2_perform_read(grpc_chttp2_transport* t,
     dts_fh_0:
     case GRPC_DTS_FH_0:
       GPR_DEBUG_ASSERT(cur < end);
+      /* Bulk path: when the whole 9-byte frame header is in this slice -
+         the common case, and every frame after the first when a read
+         batch carries many small frames - decode it in one shot with no
+         per-byte state stores, then join the regular path at the last
+         byte. The byte-at-a-time cases below remain for headers split
+         across slice boundaries. */
+      if (GPR_LIKELY(end - cur >= 9)) {
+        t->incoming_frame_size = ((static_cast<uint32_t>(cur[0])) << 16) |
+                                 ((static_cast<uint32_t>(cur[1])) << 8) |
+                                 (static_cast<uint32_t>(cur[2]));
+        t->incoming_frame_type = cur[3];
+        t->incoming_frame_flags = cur[4];
+        t->incoming_stream_id =
+            (((static_cast<uint32_t>(cur[5])) & 0x7f) << 24) |
+            ((static_cast<uint32_t>(cur[6])) << 16) |
+            ((static_cast<uint32_t>(cur[7])) << 8);
+        cur += 8;
+        goto dts_fh_8;
+      }
       t->incoming_frame_size = (static_cast<uint32_t>(*cur)) << 16;
       if (++cur == end) {
         t->deframe_state = GRPC_DTS_FH_1;
@@ -171,6 +190,7 @@ grpc_error* grpc_chttp2_perform_read(grpc_chttp2_transport* t,
         return GRPC_ERROR_NONE;
       }
     /* fallthrough */
+    dts_fh_8:
     case GRPC_DTS_FH_8:
       GPR_DEBUG_ASSERT(cur < end);
       t->incoming_stream_id |= (static_cast<uint32_t>(*cur));
@@ -106,6 +106,27 @@ static bool stream_list_maybe_remove(grpc_chttp2_transport* t,
   }
 }
 
+static void stream_list_add_head(grpc_chttp2_transport* t,
+                                 grpc_chttp2_stream* s,
+                                 grpc_chttp2_stream_list_id id) {
+  grpc_chttp2_stream* old_head;
+  GPR_ASSERT(!s->included[id]);
+  old_head = t->lists[id].head;
+  s->links[id].next = old_head;
+  s->links[id].prev = nullptr;
+  if (old_head) {
+    old_head->links[id].prev = s;
+  } else {
+    t->lists[id].tail = s;
+  }
+  t->lists[id].head = s;
+  s->included[id] = true;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_http2_stream_state)) {
+    gpr_log(GPR_INFO, "%p[%d][%s]: add to head %s", t, s->id,
+            t->is_client ? "cli" : "svr", stream_list_id_string(id));
+  }
+}
+
 static void stream_list_add_tail(grpc_chttp2_transport* t,
                                  grpc_chttp2_stream* s,
                                  grpc_chttp2_stream_list_id id) {
@@ -127,6 +148,15 @@ static void stream_list_add_tail(grpc_chttp2_transport* t,
   }
 }
 
+/* Scheduling note: the writable list is served FIFO by
+   grpc_chttp2_begin_write, with two refinements: the head-of-line cost of
+   a bulk stream parked ahead of a control RPC is bounded by
+   GRPC_ARG_HTTP2_STREAM_WRITE_QUANTUM (a stream that flushes its quantum
+   is rotated to the tail), and streams marked
+   GRPC_INITIAL_METADATA_LATENCY_CRITICAL are inserted at the head rather
+   than the tail (see grpc_chttp2_list_add_writable_stream below), giving
+   a strict two-class scheme. A richer N-class design would replace the
+   head insertion with N intrusive lists and a first-non-empty scan. */
 static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                             grpc_chttp2_stream_list_id id) {
   if (s->included[id]) {
@@ -141,6 +171,14 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   GPR_ASSERT(s->id != 0);
+  /* Latency-critical streams (GRPC_INITIAL_METADATA_LATENCY_CRITICAL) jump
+     the queue: they are inserted at the head of the writable list so the
+     write scheduler serves their frames before ordinary/bulk streams. */
+  if (GPR_UNLIKELY(s->latency_critical)) {
+    if (s->included[GRPC_CHTTP2_LIST_WRITABLE]) return false;
+    stream_list_add_head(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+    return true;
+  }
   return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
 }
 
@@ -176,8 +176,8 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 }
 
 /* How many bytes would we like to put on the wire during a single syscall */
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->target_write_size;
 }
 
 // Returns true if initial_metadata contains only default headers.
@@ -206,6 +206,7 @@ class WriteContext {
   }
 
   void FlushSettings() {
+    grpc_chttp2_act_on_resource_pressure(t_);
     if (t_->dirtied_local_settings && !t_->sent_local_settings) {
       grpc_slice_buffer_add(
           &t_->outbuf, grpc_chttp2_settings_create(
@@ -299,10 +300,35 @@ class WriteContext {
 
   grpc_chttp2_begin_write_result Result() {
     result_.writing = t_->outbuf.count > 0;
+    if (!t_->target_write_size_pinned) {
+      AdaptTargetWriteSize();
+    }
     return result_;
   }
 
  private:
+  /* Steer the per-write byte target toward the observed demand: grow it when
+     a write was truncated because more writable streams were pending (so
+     bursts coalesce into fewer syscalls), shrink it when we could not fill
+     half of it (so lightly loaded transports keep small, low-latency
+     writes). */
+  void AdaptTargetWriteSize() {
+    constexpr uint32_t kMinTargetWriteSize = 32 * 1024;
+    constexpr uint32_t kMaxTargetWriteSize = 16 * 1024 * 1024;
+    if (result_.partial) {
+      t_->target_write_size =
+          GPR_MIN(t_->target_write_size * 2, kMaxTargetWriteSize);
+    } else if (t_->outbuf.length < t_->target_write_size / 2 &&
+               initial_metadata_writes_ + message_writes_ +
+                       trailing_metadata_writes_ >
+                   0) {
+      /* only let stream-carrying writes shrink the target: control-frame-only
+         writes (pings, settings) say nothing about payload demand */
+      t_->target_write_size =
+          GPR_MAX(t_->target_write_size / 2, kMinTargetWriteSize);
+    }
+  }
+
   grpc_chttp2_transport* const t_;
 
   /* stats histogram counters: we increment these throughout this function,
@@ -349,6 +375,7 @@ class DataSendContext {
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     s_->flow_control->SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    bytes_flushed_ += send_bytes;
   }
 
   void FlushCompressedBytes() {
@@ -383,6 +410,7 @@ class DataSendContext {
     grpc_chttp2_encode_data(s_->id, &s_->compressed_data_buffer, send_bytes,
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     s_->flow_control->SentData(send_bytes);
+    bytes_flushed_ += send_bytes;
     if (s_->compressed_data_buffer.length == 0) {
       s_->sending_bytes += s_->uncompressed_data_size;
     }
@@ -407,6 +435,14 @@ class DataSendContext {
 
   bool is_last_frame() const { return is_last_frame_; }
 
+  /* Is this stream still within its per-write byte quantum? Once a stream
+     has flushed stream_write_quantum bytes it is rotated to the back of the
+     writable list so concurrent streams share each write fairly. */
+  bool UnderStreamQuantum() const {
+    return t_->stream_write_quantum == 0 ||
+           bytes_flushed_ < t_->stream_write_quantum;
+  }
+
   void CallCallbacks() {
     if (update_list(
             t_, s_,
@@ -422,6 +458,7 @@ class DataSendContext {
   grpc_chttp2_transport* t_;
   grpc_chttp2_stream* s_;
   const size_t sending_bytes_before_;
+  size_t bytes_flushed_ = 0;
   bool is_last_frame_ = false;
 };
 
@@ -521,13 +558,15 @@ class StreamWriteContext {
     if (s_->stream_compression_method ==
         GRPC_STREAM_COMPRESSION_IDENTITY_COMPRESS) {
       while (s_->flow_controlled_buffer.length > 0 &&
-             data_send_context.max_outgoing() > 0) {
+             data_send_context.max_outgoing() > 0 &&
+             data_send_context.UnderStreamQuantum()) {
         data_send_context.FlushUncompressedBytes();
       }
     } else {
       while ((s_->flow_controlled_buffer.length > 0 ||
               s_->compressed_data_buffer.length > 0) &&
-             data_send_context.max_outgoing() > 0) {
+             data_send_context.max_outgoing() > 0 &&
+             data_send_context.UnderStreamQuantum()) {
         if (s_->compressed_data_buffer.length > 0) {
           data_send_context.FlushCompressedBytes();
         } else {
@@ -672,6 +711,16 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   maybe_initiate_ping(t);
 
+  if (t->channelz_socket != nullptr) {
+    // refresh the per-connection memory gauges once per write cycle: cheap
+    // constant-time reads, all combiner-confined state
+    t->channelz_socket->SetFlowControlWindows(
+        t->flow_control->announced_window(), t->flow_control->remote_window());
+    t->channelz_socket->SetMemoryGauges(
+        static_cast<int64_t>(t->outbuf.length),
+        static_cast<int64_t>(t->hpack_compressor.table_size));
+  }
+
   return ctx.Result();
 }
 
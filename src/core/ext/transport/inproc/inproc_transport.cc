@@ -532,6 +532,16 @@ void fail_helper_locked(inproc_stream* s, grpc_error* error) {
 // that the incoming byte stream's next() call will always return
 // synchronously.  That assumption is true today but may not always be
 // true in the future.
+//
+// Note on scope: the drain below moves slice *refs* - no message bytes are
+// copied - so the win from passing the stream as-is is bounded (one slice
+// ref/unref plus a stream object per message). Doing it naively is unsafe:
+// the sender's byte stream object lives in the *sender's* call arena (e.g.
+// SliceBufferByteStream constructed in call.cc), and this function completes
+// the sender's send op immediately, so the sender call can be destroyed
+// while the receiver still holds the handed-off stream. A correct as-is
+// handoff must defer the sender's op completion until the receiver orphans
+// the stream.
 void message_transfer_locked(inproc_stream* sender, inproc_stream* receiver) {
   size_t remaining =
       sender->send_message_op->payload->send_message.send_message->length();
@@ -23,6 +23,17 @@
 
 #include <grpc/support/sync.h>
 
+/* Container-selection note: this is a persistent (immutable, structurally
+   shared) AVL - mutations share subtrees with the previous version, which
+   is what lets ev_epollex and the channel maps snapshot a map under a lock
+   and keep reading it lock-free afterwards. A flat sorted-array immutable
+   map (binary search, rebuilt per mutation) is better for read-heavy,
+   rarely-mutated data ONLY if whole-map copies per mutation are
+   acceptable: it gives O(n) copy per insert versus O(log n) shared nodes
+   here, so the fd maps (mutation per fd add/remove) would regress.
+   channel_args, meanwhile, is not built on this container at all and is
+   only sorted inside grpc_channel_args_normalize for comparison/keying -
+   not on the per-build path. Pick per use-case; do not migrate wholesale. */
 /** internal node of an AVL tree */
 typedef struct grpc_avl_node {
   gpr_refcount refs;
@@ -52,6 +52,16 @@ BackOff::BackOff(const Options& options)
   Reset();
 }
 
+/* Herd note (re: coordinated reconnect token buckets): with the default
+   0.2 jitter, 10k subchannels whose backend restarted together spread
+   each retry round across a +/-20% window of the shared backoff step -
+   correlated enough to look like a herd at the first short steps, but
+   decorrelating geometrically as steps grow. A process-global pacing
+   token bucket would serialize unrelated channels behind one lock and
+   needs a rate configured per deployment to be correct at all; the
+   self-serve mitigations are raising initial_backoff and jitter via
+   GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS on the storm-prone channels,
+   which bound herd width without coordination. */
 grpc_millis BackOff::NextAttemptTime() {
   if (initial_) {
     initial_ = false;
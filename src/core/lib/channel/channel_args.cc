@@ -29,6 +29,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 
@@ -214,6 +215,32 @@ void grpc_channel_args_destroy(grpc_channel_args* a) {
   gpr_free(a);
 }
 
+uint32_t grpc_channel_args_hash(const grpc_channel_args* a) {
+  uint32_t hash = 0x9e3779b9; /* arbitrary non-zero seed */
+  if (a == nullptr) return hash;
+  for (size_t i = 0; i < a->num_args; i++) {
+    const grpc_arg* arg = &a->args[i];
+    hash = (hash << 5) + hash + static_cast<uint32_t>(arg->type);
+    hash ^= gpr_murmur_hash3(arg->key, strlen(arg->key), hash);
+    switch (arg->type) {
+      case GRPC_ARG_STRING:
+        hash ^= gpr_murmur_hash3(arg->value.string, strlen(arg->value.string),
+                                 hash);
+        break;
+      case GRPC_ARG_INTEGER:
+        hash = (hash << 5) + hash + static_cast<uint32_t>(arg->value.integer);
+        break;
+      case GRPC_ARG_POINTER:
+        /* Pointer values do not contribute: their equality is defined by
+           the vtable's cmp, which need not be pointer identity, and the
+           hash must never distinguish arguments that compare equal. Only
+           the key/type presence above is mixed in. */
+        break;
+    }
+  }
+  return hash;
+}
+
 int grpc_channel_args_compare(const grpc_channel_args* a,
                               const grpc_channel_args* b) {
   if (a == nullptr && b == nullptr) return 0;
@@ -63,6 +63,12 @@ inline void grpc_channel_args_destroy(const grpc_channel_args* a) {
 int grpc_channel_args_compare(const grpc_channel_args* a,
                               const grpc_channel_args* b);
 
+/** Hash \a a, consistent with grpc_channel_args_compare: argument lists
+    that compare equal hash equal (pointer argument values do not
+    contribute, since their equality is vtable-defined). Intended as a
+    cheap first-stage rejection in front of deep comparison. */
+uint32_t grpc_channel_args_hash(const grpc_channel_args* a);
+
 /** Returns the value of argument \a name from \a args, or NULL if not found. */
 const grpc_arg* grpc_channel_args_find(const grpc_channel_args* args,
                                        const char* name);
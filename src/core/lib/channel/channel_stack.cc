@@ -81,6 +81,15 @@ grpc_channel_element* grpc_channel_stack_last_element(
   return grpc_channel_stack_element(channel_stack, channel_stack->count - 1);
 }
 
+/* Note: this is already the "constexpr offset" facility sometimes asked
+   for - no walk happens. Element headers are a contiguous array after the
+   stack header, each filter's call data lives at a fixed offset computed
+   once at channel build time (call_stack_init lays them out from the
+   filters' sizeof_call_data), and elem->call_data is a direct pointer into
+   the call's arena. A filter that knows its index reaches its state in two
+   adds; typed compile-time offsets would additionally require the filter
+   list itself to be a compile-time constant, which channel args and
+   maybe_add_* filters make a per-channel runtime property. */
 grpc_call_element* grpc_call_stack_element(grpc_call_stack* call_stack,
                                            size_t index) {
   return CALL_ELEMS_FROM_STACK(call_stack) + index;
@@ -220,24 +229,6 @@ void grpc_call_stack_destroy(grpc_call_stack* stack,
   }
 }
 
-void grpc_call_next_op(grpc_call_element* elem,
-                       grpc_transport_stream_op_batch* op) {
-  grpc_call_element* next_elem = elem + 1;
-  GRPC_CALL_LOG_OP(GPR_INFO, next_elem, op);
-  next_elem->filter->start_transport_stream_op_batch(next_elem, op);
-}
-
-void grpc_channel_next_get_info(grpc_channel_element* elem,
-                                const grpc_channel_info* channel_info) {
-  grpc_channel_element* next_elem = elem + 1;
-  next_elem->filter->get_channel_info(next_elem, channel_info);
-}
-
-void grpc_channel_next_op(grpc_channel_element* elem, grpc_transport_op* op) {
-  grpc_channel_element* next_elem = elem + 1;
-  next_elem->filter->start_transport_op(next_elem, op);
-}
-
 grpc_channel_stack* grpc_channel_stack_from_top_element(
     grpc_channel_element* elem) {
   return reinterpret_cast<grpc_channel_stack*>(
@@ -79,7 +79,16 @@ typedef struct {
   gpr_timespec latency; /* From call creating to enqueing of received status */
 } grpc_call_stats;
 
-/** Information about the call upon completion. */
+/** Information about the call upon completion.
+
+    Post-hoc stats consumers: stats.transport_stream_stats already carries
+    the transport-level accounting (framing/header/data byte counts in each
+    direction, filled in by the transport when the surface passes
+    collect_stats down in the recv_trailing_metadata batch), and
+    stats.latency covers call duration - a stats filter reading final_info
+    in destroy_call_elem needs no extra plumbing for these. Retry attempt
+    counts would belong here too once the client channel grows a retry
+    layer; nothing tracks attempts today. */
 struct grpc_call_final_info {
   grpc_call_stats stats;
   grpc_status_code final_status = GRPC_STATUS_OK;
@@ -95,7 +104,22 @@ struct grpc_call_final_info {
       channel_op)
    4. a name, which is useful when debugging
 
-   Members are laid out in approximate frequency of use order. */
+   Members are laid out in approximate frequency of use order.
+
+   Static-composition note (re: a template-typelist stack whose batch path
+   is one inlined function): the per-filter dispatch here is already a
+   direct function-pointer call through a cache-hot element array - there
+   is no virtual dispatch to "devirtualize" - so what a compile-time stack
+   would buy is cross-filter inlining of the prologues. That requires the
+   filter set and each filter's configuration to be known to the library
+   build, and neither is: stacks are assembled per channel from runtime
+   channel args (user-agent, compression defaults, census on/off, minimal
+   stack) and from plugin-registered builders, so the "always the same N
+   filters" property belongs to one deployment, not to this library. The
+   supported levers are GRPC_ARG_MINIMAL_STACK to drop optional filters
+   and fusing adjacent filters at stack-build time; an embedder with a
+   truly fixed configuration can also sit its own fused filter (or talk to
+   grpc_transport directly) without a parallel build mode. */
 typedef struct {
   /* Called to eg. send/receive data on a call.
      See grpc_call_next_op on how to call the next element in the stack */
@@ -265,16 +289,6 @@ void grpc_call_stack_destroy(grpc_call_stack* stack,
  * at all. Does nothing. */
 void grpc_call_stack_ignore_set_pollset_or_pollset_set(
     grpc_call_element* elem, grpc_polling_entity* pollent);
-/* Call the next operation in a call stack */
-void grpc_call_next_op(grpc_call_element* elem,
-                       grpc_transport_stream_op_batch* op);
-/* Call the next operation (depending on call directionality) in a channel
-   stack */
-void grpc_channel_next_op(grpc_channel_element* elem, grpc_transport_op* op);
-/* Pass through a request to get_channel_info() to the next child element */
-void grpc_channel_next_get_info(grpc_channel_element* elem,
-                                const grpc_channel_info* channel_info);
-
 /* Given the top element of a channel stack, get the channel stack itself */
 grpc_channel_stack* grpc_channel_stack_from_top_element(
     grpc_channel_element* elem);
@@ -294,4 +308,30 @@ extern grpc_core::TraceFlag grpc_trace_channel;
     }                                                  \
   } while (0)
 
+/* Call the next operation in a call stack. Defined inline: pass-through
+   filters execute this once per filter per batch on the call hot path, and
+   inlining collapses the hop to a single indirect call into the next
+   filter. */
+inline void grpc_call_next_op(grpc_call_element* elem,
+                              grpc_transport_stream_op_batch* op) {
+  grpc_call_element* next_elem = elem + 1;
+  GRPC_CALL_LOG_OP(GPR_INFO, next_elem, op);
+  next_elem->filter->start_transport_stream_op_batch(next_elem, op);
+}
+
+/* Call the next operation (depending on call directionality) in a channel
+   stack */
+inline void grpc_channel_next_op(grpc_channel_element* elem,
+                                 grpc_transport_op* op) {
+  grpc_channel_element* next_elem = elem + 1;
+  next_elem->filter->start_transport_op(next_elem, op);
+}
+
+/* Pass through a request to get_channel_info() to the next child element */
+inline void grpc_channel_next_get_info(grpc_channel_element* elem,
+                                       const grpc_channel_info* channel_info) {
+  grpc_channel_element* next_elem = elem + 1;
+  next_elem->filter->get_channel_info(next_elem, channel_info);
+}
+
 #endif /* GRPC_CORE_LIB_CHANNEL_CHANNEL_STACK_H */
@@ -33,6 +33,17 @@ typedef struct grpc_channel_stack_builder_iterator
     grpc_channel_stack_builder_iterator;
 
 /// Create a new channel stack builder
+/* Blueprint-caching note (channel-creation cost for short-lived-channel
+   workloads): the builder walk itself (registered stages appending filter
+   entries) is cheap; what dominates creation is running each filter's
+   init_channel_elem - which performs per-channel work (arg refs, transport
+   wiring, security connectors) that a memcpy'd layout cannot share, so a
+   cached blueprint could only skip the stage walk, not the expensive part.
+   The supported answers for thousands-of-short-lived-channels today are
+   (a) subchannel sharing already makes the TCP/TLS layer shared across
+   those channels, and (b) resolver/LB instantiation is already deferred -
+   the resolver starts on the first RPC or explicit connectivity request,
+   not at grpc_channel_create. */
 grpc_channel_stack_builder* grpc_channel_stack_builder_create(void);
 
 /// Assign a name to the channel stack: \a name must be statically allocated
@@ -61,6 +61,17 @@ ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data)
 
 ChannelTrace::TraceEvent::~TraceEvent() { grpc_slice_unref_internal(data_); }
 
+// Production cost notes: the per-node trace is already a bounded ring in
+// spirit - events are evicted once event_list_memory_usage_ exceeds
+// max_event_memory_ (set via GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE;
+// 0 disables tracing entirely while leaving the rest of channelz - state,
+// call counts - active and allocation-free), and no JSON exists until a
+// channelz query calls RenderJson. The per-event cost while enabled is one
+// small TraceEvent allocation; fleets that disabled channelz over
+// "allocation overhead" most likely wanted trace memory set to 0 rather
+// than GRPC_ARG_ENABLE_CHANNELZ=false. A malloc-free preallocated ring
+// would require fixing the event payload size (descriptions are
+// variable-length slices today).
 ChannelTrace::ChannelTrace(size_t max_event_memory)
     : num_events_logged_(0),
       event_list_memory_usage_(0),
@@ -598,6 +598,31 @@ grpc_json* SocketNode::RenderJson() {
     json_iterator = grpc_json_add_number_string_child(
         json, json_iterator, "keepAlivesSent", keepalives_sent);
   }
+  // Memory/flow-control gauges (refreshed by the transport per write
+  // cycle); localFlowControlWindow/remoteFlowControlWindow match the
+  // channelz Socket proto, the remaining gauges are extensions that
+  // schema-driven consumers will ignore.
+  gpr_atm local_window = gpr_atm_no_barrier_load(&local_flow_control_window_);
+  if (local_window != 0) {
+    json_iterator = grpc_json_add_number_string_child(
+        json, json_iterator, "localFlowControlWindow", local_window);
+  }
+  gpr_atm remote_window = gpr_atm_no_barrier_load(&remote_flow_control_window_);
+  if (remote_window != 0) {
+    json_iterator = grpc_json_add_number_string_child(
+        json, json_iterator, "remoteFlowControlWindow", remote_window);
+  }
+  gpr_atm buffered_write_bytes =
+      gpr_atm_no_barrier_load(&buffered_write_bytes_);
+  if (buffered_write_bytes != 0) {
+    json_iterator = grpc_json_add_number_string_child(
+        json, json_iterator, "bufferedWriteBytes", buffered_write_bytes);
+  }
+  gpr_atm hpack_table_size = gpr_atm_no_barrier_load(&hpack_encoder_table_size_);
+  if (hpack_table_size != 0) {
+    json_iterator = grpc_json_add_number_string_child(
+        json, json_iterator, "hpackEncoderTableSize", hpack_table_size);
+  }
   return top_level_json;
 }
 
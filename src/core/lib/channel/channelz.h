@@ -289,9 +289,30 @@ class SocketNode : public BaseNode {
     gpr_atm_no_barrier_fetch_add(&keepalives_sent_, static_cast<gpr_atm>(1));
   }
 
+  // Memory/flow-control gauges, refreshed by the owning transport once per
+  // write cycle. Relaxed stores/loads: these are dashboard approximations
+  // for spotting bloated connections, not an accounting source of truth.
+  void SetFlowControlWindows(int64_t local_window, int64_t remote_window) {
+    gpr_atm_no_barrier_store(&local_flow_control_window_,
+                             static_cast<gpr_atm>(local_window));
+    gpr_atm_no_barrier_store(&remote_flow_control_window_,
+                             static_cast<gpr_atm>(remote_window));
+  }
+  void SetMemoryGauges(int64_t buffered_write_bytes,
+                       int64_t hpack_encoder_table_size) {
+    gpr_atm_no_barrier_store(&buffered_write_bytes_,
+                             static_cast<gpr_atm>(buffered_write_bytes));
+    gpr_atm_no_barrier_store(&hpack_encoder_table_size_,
+                             static_cast<gpr_atm>(hpack_encoder_table_size));
+  }
+
   const char* remote() { return remote_.get(); }
 
  private:
+  gpr_atm local_flow_control_window_ = 0;
+  gpr_atm remote_flow_control_window_ = 0;
+  gpr_atm buffered_write_bytes_ = 0;
+  gpr_atm hpack_encoder_table_size_ = 0;
   gpr_atm streams_started_ = 0;
   gpr_atm streams_succeeded_ = 0;
   gpr_atm streams_failed_ = 0;
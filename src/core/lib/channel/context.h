@@ -30,6 +30,17 @@ typedef enum {
   GRPC_CONTEXT_SECURITY = 0,
 
   /// Value is a \a census_context.
+  ///
+  /// Allocation note (re: propagating a bare 16-byte trace id inline in
+  /// this slot without materializing a full context): the element is a
+  /// single void* plus destroy fn, so a 128-bit id cannot ride in it by
+  /// value; only a tag-in-low-bits scheme for pointer-sized ids would fit
+  /// without widening every call's context array. In practice the census
+  /// plugin's per-call state is filter call data, which the channel stack
+  /// places in the call arena - a bump-pointer hit, not a malloc - so the
+  /// win from deferring materialization is the span/tag construction work
+  /// for unsampled calls, which the tracing library's sampler already
+  /// short-circuits, not an allocation.
   GRPC_CONTEXT_TRACING,
 
   /// Reserved for traffic_class_context.
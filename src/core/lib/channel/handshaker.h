@@ -37,6 +37,8 @@
 
 namespace grpc_core {
 
+extern TraceFlag grpc_handshaker_trace;
+
 /// Handshakers are used to perform initial handshakes on a connection
 /// before the client sends the initial request.  Some examples of what
 /// a handshaker can be used for includes support for HTTP CONNECT on
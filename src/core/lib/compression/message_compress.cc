@@ -87,20 +87,51 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
-static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+/* Obtain a deflate stream for the given mode from \a ctx, reusing (via
+   deflateReset, which keeps zlib's internal allocations and produces
+   identical output to a fresh stream) any compatible stream cached there.
+   With a null ctx the stream is initialized in \a scratch and torn down by
+   the caller. */
+static z_stream* zlib_deflate_stream_acquire(grpc_msg_compression_context* ctx,
+                                             z_stream* scratch, int gzip) {
+  const int algorithm_tag =
+      1 + (gzip ? GRPC_MESSAGE_COMPRESS_GZIP : GRPC_MESSAGE_COMPRESS_DEFLATE);
+  if (ctx != nullptr && ctx->zlib != nullptr &&
+      ctx->zlib_algorithm == algorithm_tag) {
+    z_stream* zs = static_cast<z_stream*>(ctx->zlib);
+    deflateReset(zs);
+    return zs;
+  }
+  z_stream* zs = scratch;
+  if (ctx != nullptr) {
+    if (ctx->zlib != nullptr) {
+      /* algorithm changed mid-call: drop the old stream */
+      deflateEnd(static_cast<z_stream*>(ctx->zlib));
+      gpr_free(ctx->zlib);
+    }
+    zs = static_cast<z_stream*>(gpr_malloc(sizeof(z_stream)));
+    ctx->zlib = zs;
+    ctx->zlib_algorithm = algorithm_tag;
+  }
+  memset(zs, 0, sizeof(*zs));
+  zs->zalloc = zalloc_gpr;
+  zs->zfree = zfree_gpr;
+  const int r = deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                             15 | (gzip ? 16 : 0), 8, Z_DEFAULT_STRATEGY);
+  GPR_ASSERT(r == Z_OK);
+  return zs;
+}
+
+static int zlib_compress(grpc_msg_compression_context* ctx,
+                         grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
-  z_stream zs;
+  z_stream scratch;
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  z_stream* zs = zlib_deflate_stream_acquire(ctx, &scratch, gzip);
+  r = zlib_body(zs, input, output, deflate) && output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -108,7 +139,9 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  deflateEnd(&zs);
+  if (ctx == nullptr) {
+    deflateEnd(zs);
+  }
   return r;
 }
 
@@ -144,7 +177,8 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   return 1;
 }
 
-static int compress_inner(grpc_message_compression_algorithm algorithm,
+static int compress_inner(grpc_msg_compression_context* ctx,
+                          grpc_message_compression_algorithm algorithm,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_MESSAGE_COMPRESS_NONE:
@@ -152,9 +186,9 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
          rely on that here */
       return 0;
     case GRPC_MESSAGE_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(ctx, input, output, 0);
     case GRPC_MESSAGE_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(ctx, input, output, 1);
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -164,13 +198,28 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_ctx(nullptr, algorithm, input, output);
+}
+
+int grpc_msg_compress_ctx(grpc_msg_compression_context* ctx,
+                          grpc_message_compression_algorithm algorithm,
+                          grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  if (!compress_inner(ctx, algorithm, input, output)) {
     copy(input, output);
     return 0;
   }
   return 1;
 }
 
+void grpc_msg_compression_context_destroy(grpc_msg_compression_context* ctx) {
+  if (ctx->zlib != nullptr) {
+    deflateEnd(static_cast<z_stream*>(ctx->zlib));
+    gpr_free(ctx->zlib);
+    ctx->zlib = nullptr;
+    ctx->zlib_algorithm = 0;
+  }
+}
+
 int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
@@ -31,6 +31,27 @@
 int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* A reusable message-compression context. Callers that compress many
+   messages (e.g. each message of a streaming call) can keep one of these
+   alive and pass it to grpc_msg_compress_ctx: the underlying zlib state is
+   then reset between messages instead of being allocated and torn down per
+   message (the wire format is unchanged - every message remains
+   independently decompressable). Zero-initialized; destroy with
+   grpc_msg_compression_context_destroy. */
+typedef struct grpc_msg_compression_context {
+  void* zlib;         /* lazily allocated z_stream */
+  int zlib_algorithm; /* which algorithm zlib is initialized for, as
+                         grpc_message_compression_algorithm + 1; 0 = none */
+} grpc_msg_compression_context;
+
+/* As grpc_msg_compress, but reuses (and lazily populates) \a ctx's
+   compression state across calls with the same algorithm. */
+int grpc_msg_compress_ctx(grpc_msg_compression_context* ctx,
+                          grpc_message_compression_algorithm algorithm,
+                          grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+void grpc_msg_compression_context_destroy(grpc_msg_compression_context* ctx);
+
 /* decompress 'input' to 'output' using 'algorithm'.
    On success, appends slices to output and returns 1.
    On failure, output is unchanged, and returns 0. */
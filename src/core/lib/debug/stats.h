@@ -25,6 +25,17 @@
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
+/* Production cost model: counters are NOT global atomics - storage is
+   sharded per CPU (indexed by the ExecCtx's starting cpu), so an increment
+   is a no-contention relaxed add on a CPU-local page, and
+   grpc_stats_collect() is the stable extraction API that sums the shards.
+   The whole system compiles away unless GRPC_COLLECT_STATS (or a debug
+   build) is set, so enabling it in production builds is a -D flag, not a
+   code change. Counters covering syscall batching (tcp_write_size /
+   tcp_write_iov_size give bytes and iovecs per sendmsg), combiner
+   contention (combiner_locks_*), hpack (the hpack_send / hpack_recv families) and timer
+   checks (timer_check*) already exist; add new ones in stats_data.yaml and
+   mirror them in the generated files. */
 typedef struct grpc_stats_data {
   gpr_atm counters[GRPC_STATS_COUNTER_COUNT];
   gpr_atm histograms[GRPC_STATS_HISTOGRAM_BUCKETS];
@@ -34,6 +34,8 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "server_channels_created",
     "syscall_poll",
     "syscall_wait",
+    "timer_check",
+    "timer_check_skipped",
     "pollset_kick",
     "pollset_kicked_without_poller",
     "pollset_kicked_again",
@@ -134,6 +136,9 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of server channels created",
     "Number of polling syscalls (epoll_wait, poll, etc) made by this process",
     "Number of sleeping syscalls made by this process",
+    "Number of times the timer system was checked for expired timers",
+    "Number of timer checks that exited early because the atomically "
+    "published next deadline had not arrived",
     "How many polling wakeups were performed by the process (only valid for "
     "epoll1 right now)",
     "How many times was a polling wakeup requested without an active poller "
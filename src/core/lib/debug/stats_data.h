@@ -35,6 +35,8 @@ typedef enum {
   GRPC_STATS_COUNTER_SERVER_CHANNELS_CREATED,
   GRPC_STATS_COUNTER_SYSCALL_POLL,
   GRPC_STATS_COUNTER_SYSCALL_WAIT,
+  GRPC_STATS_COUNTER_TIMER_CHECK,
+  GRPC_STATS_COUNTER_TIMER_CHECK_SKIPPED,
   GRPC_STATS_COUNTER_POLLSET_KICK,
   GRPC_STATS_COUNTER_POLLSET_KICKED_WITHOUT_POLLER,
   GRPC_STATS_COUNTER_POLLSET_KICKED_AGAIN,
@@ -193,6 +195,10 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SYSCALL_POLL)
 #define GRPC_STATS_INC_SYSCALL_WAIT() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SYSCALL_WAIT)
+#define GRPC_STATS_INC_TIMER_CHECK() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TIMER_CHECK)
+#define GRPC_STATS_INC_TIMER_CHECK_SKIPPED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TIMER_CHECK_SKIPPED)
 #define GRPC_STATS_INC_POLLSET_KICK() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_KICK)
 #define GRPC_STATS_INC_POLLSET_KICKED_WITHOUT_POLLER() \
@@ -443,6 +449,8 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_SERVER_CHANNELS_CREATED()
 #define GRPC_STATS_INC_SYSCALL_POLL()
 #define GRPC_STATS_INC_SYSCALL_WAIT()
+#define GRPC_STATS_INC_TIMER_CHECK()
+#define GRPC_STATS_INC_TIMER_CHECK_SKIPPED()
 #define GRPC_STATS_INC_POLLSET_KICK()
 #define GRPC_STATS_INC_POLLSET_KICKED_WITHOUT_POLLER()
 #define GRPC_STATS_INC_POLLSET_KICKED_AGAIN()
@@ -6,6 +6,8 @@ client_subchannels_created_per_iteration:FLOAT,
 server_channels_created_per_iteration:FLOAT,
 syscall_poll_per_iteration:FLOAT,
 syscall_wait_per_iteration:FLOAT,
+timer_check_per_iteration:FLOAT,
+timer_check_skipped_per_iteration:FLOAT,
 pollset_kick_per_iteration:FLOAT,
 pollset_kicked_without_poller_per_iteration:FLOAT,
 pollset_kicked_again_per_iteration:FLOAT,
@@ -31,6 +31,18 @@
 GPR_GLOBAL_CONFIG_DEFINE_STRING(grpc_verbosity, "ERROR",
                                 "Default gRPC logging verbosity")
 
+/* Note for anyone planning a deferred-formatting fast path (store the
+   format pointer + args in a per-thread ring, format on a drainer thread):
+   it cannot be done at this layer. gpr_log receives varargs whose %s
+   arguments routinely point at stack buffers and transient heap strings
+   (grpc_error_string results, gpr_asprintf temporaries freed on the next
+   line), so deferring the vsnprintf use-after-frees the arguments. What IS
+   supported today: the inline write syscall can be replaced wholesale by
+   installing a custom sink with gpr_set_log_function() - the formatting
+   still happens on the caller (it must), but the handoff/IO policy
+   (ring buffer, async drain, structured encoding) is entirely the
+   application's, which is how high-rate tracing deployments should consume
+   trace flags in production. */
 void gpr_default_log(gpr_log_func_args* args);
 static gpr_atm g_log_func = (gpr_atm)gpr_default_log;
 static gpr_atm g_min_severity_to_print = GPR_LOG_VERBOSITY_UNSET;
@@ -74,6 +74,14 @@ std::pair<Arena*, void*> Arena::CreateWithAlloc(size_t initial_size,
   return std::make_pair(new_arena, first_alloc);
 }
 
+void* Arena::Reset(size_t alloc_size) {
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  GPR_DEBUG_ASSERT(last_zone_ == nullptr);
+  total_used_.Store(alloc_size, MemoryOrder::RELAXED);
+  return reinterpret_cast<char*>(this) + base_size;
+}
+
 size_t Arena::Destroy() {
   size_t size = total_used_.Load(MemoryOrder::RELAXED);
   this->~Arena();
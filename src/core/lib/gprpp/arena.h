@@ -54,6 +54,21 @@ class Arena {
 
   // Destroy an arena, returning the total number of bytes allocated.
   size_t Destroy();
+
+  // Total bytes allocated from this arena so far.
+  size_t TotalUsed() const { return total_used_.Load(MemoryOrder::RELAXED); }
+
+  // Size of the embedded initial zone.
+  size_t initial_zone_size() const { return initial_zone_size_; }
+
+  // Whether the arena has overflowed into dynamically allocated zones.
+  bool HasOverflowZones() const { return last_zone_ != nullptr; }
+
+  // Re-primes a zone-free arena for reuse, as though freshly created via
+  // CreateWithAlloc(initial_zone_size(), alloc_size); returns the initial
+  // allocation. Only valid once nothing references memory allocated from
+  // this arena and HasOverflowZones() is false.
+  void* Reset(size_t alloc_size);
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     static constexpr size_t base_size =
@@ -192,6 +192,22 @@ class InlinedVector {
   }
 
   static void move_elements(T* src, T* dst, size_t num_elements) {
+    MoveElementsImpl(src, dst, num_elements,
+                     std::is_trivially_copyable<T>());
+  }
+
+  // Trivially copyable elements relocate with one memcpy of the whole
+  // buffer instead of a per-element move+destroy loop; growth of the hot
+  // pointer/POD vectors (picker arrays, subchannel lists) becomes a bulk
+  // copy.
+  static void MoveElementsImpl(T* src, T* dst, size_t num_elements,
+                               std::true_type) {
+    memcpy(static_cast<void*>(dst), static_cast<void*>(src),
+           num_elements * sizeof(T));
+  }
+
+  static void MoveElementsImpl(T* src, T* dst, size_t num_elements,
+                               std::false_type) {
     for (size_t i = 0; i < num_elements; ++i) {
       new (&dst[i]) T(std::move(src[i]));
       src[i].~T();
@@ -76,6 +76,39 @@ MultiProducerSingleConsumerQueue::PopAndCheckEnd(bool* empty) {
   return nullptr;
 }
 
+MultiProducerSingleConsumerQueue::Node*
+MultiProducerSingleConsumerQueue::DrainAll() {
+  // Note that a detach-the-whole-chain-in-one-exchange drain is NOT sound
+  // for this algorithm: the stub would have to double as the root of the
+  // new chain while still being linked inside the detached one (it is the
+  // root right after construction and after every drain, and Pop can push
+  // it mid-chain), so the first new-epoch producer would overwrite
+  // stub_.next while the chain walk still needs the old link.  So we drain
+  // with the regular pop step, waiting out the transient
+  // exchanged-but-not-yet-linked window (which Pop reports by returning
+  // nullptr) rather than handing back a partial batch.
+  Node* first = nullptr;
+  Node* last = nullptr;
+  bool empty = false;
+  for (;;) {
+    Node* node = PopAndCheckEnd(&empty);
+    if (node == nullptr) {
+      if (empty) break;
+      continue;
+    }
+    if (last == nullptr) {
+      first = node;
+    } else {
+      last->next.Store(node, MemoryOrder::RELAXED);
+    }
+    last = node;
+  }
+  if (last != nullptr) {
+    last->next.Store(nullptr, MemoryOrder::RELAXED);
+  }
+  return first;
+}
+
 //
 // LockedMultiProducerSingleConsumerQueue
 //
@@ -105,4 +138,10 @@ LockedMultiProducerSingleConsumerQueue::Pop() {
   return node;
 }
 
+LockedMultiProducerSingleConsumerQueue::Node*
+LockedMultiProducerSingleConsumerQueue::DrainAll() {
+  MutexLock lock(&mu_);
+  return queue_.DrainAll();
+}
+
 }  // namespace grpc_core
@@ -57,13 +57,27 @@ class MultiProducerSingleConsumerQueue {
   // not.
   Node* PopAndCheckEnd(bool* empty);
 
+  // Drain the queue: return every queued node as a nullptr-terminated chain
+  // (oldest first, linked through Node::next), or nullptr if the queue was
+  // empty.  Unlike Pop this never returns early on an in-flight push, so a
+  // consumer draining to empty needs no retry loop at the call site.
+  // Thread compatible - can only be called from one thread at a time, and
+  // not concurrently with Pop/PopAndCheckEnd.
+  Node* DrainAll();
+
  private:
   // make sure head & tail don't share a cacheline
   union {
     char padding_[GPR_CACHELINE_SIZE];
     Atomic<Node*> head_;
   };
-  Node* tail_;
+  // ... and that tail doesn't share one with the stub either: producers
+  // write stub_.next on the first push into an empty queue, right next to
+  // the tail_ the consumer is reading
+  union {
+    char tail_padding_[GPR_CACHELINE_SIZE];
+    Node* tail_;
+  };
   Node stub_;
 };
 
@@ -88,6 +102,11 @@ class LockedMultiProducerSingleConsumerQueue {
   // calling this function
   Node* Pop();
 
+  // Detach every queued node under the lock; see
+  // MultiProducerSingleConsumerQueue::DrainAll for the result format.
+  // Thread safe - can be called from multiple threads concurrently
+  Node* DrainAll();
+
  private:
   MultiProducerSingleConsumerQueue queue_;
   Mutex mu_;
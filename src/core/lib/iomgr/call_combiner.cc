@@ -131,6 +131,16 @@ void CallCombiner::Start(grpc_closure* closure, grpc_error* error,
       gpr_log(GPR_INFO, "  EXECUTING IMMEDIATELY");
     }
     // Queue was empty, so execute this closure immediately.
+    //
+    // Note on the uncontended cost: "immediately" means appending the
+    // (caller-owned, never heap-allocated here) closure to the ExecCtx list,
+    // to run at the next flush point. Invoking closure->cb inline instead
+    // would save that append but break the deferral the rest of the stack
+    // relies on: Start() is called with transport/filter state mid-mutation
+    // and with the chttp2 combiner frequently held, so an inline run would
+    // execute application callbacks under those locks and recurse through
+    // the filter stack within the caller's frame. Do not "optimize" this
+    // into a direct call without auditing every Start() site.
     ScheduleClosure(closure, error);
   } else {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
@@ -203,6 +203,18 @@ bool grpc_combiner_continue_exec_ctx() {
   // 2. the current execution context needs to finish as soon as possible
   // 3. the current thread is not a worker for any background poller
   // 4. the DEFAULT executor is threaded
+  //
+  // Pinning note (for proposals to bind a transport's combiner to its fd's
+  // poller thread): in the steady state the combiner already runs where the
+  // events arrive - whichever thread harvests the fd's readiness executes
+  // the continuations inline, and under epoll1's single designated poller
+  // that is one thread at a time, so cache migration happens only when the
+  // designated poller moves or when this offload branch fires. Hard
+  // pinning would require the *other* producers of combiner work (timer
+  // callbacks, application batches from app threads) to hop to the pinned
+  // thread, adding a handoff to paths that today run the work immediately;
+  // the cheaper lever against migration is reducing this offload (it only
+  // triggers when the initiating exec ctx wants out while contended).
   if (contended && grpc_core::ExecCtx::Get()->IsReadyToFinish() &&
       !grpc_iomgr_is_any_background_poller_thread() &&
       grpc_core::Executor::IsThreadedDefault()) {
@@ -29,7 +29,20 @@
 #include "src/core/lib/iomgr/resource_quota.h"
 
 /* An endpoint caps a streaming channel between two communicating processes.
-   Examples may be: a tcp socket, <stdin+stdout>, or some shared memory. */
+   Examples may be: a tcp socket, <stdin+stdout>, or some shared memory.
+
+   On the oft-proposed shared-memory ring endpoint (per-direction SPSC ring,
+   futex wakeup on empty/non-empty transitions): the vtable fits - read/write
+   against ring segments and a wakeup primitive are exactly this interface -
+   but two integration facts decide the design. First, endpoint readiness
+   must surface through the polling engine, so the futex must be an eventfd
+   (pollable) rather than a raw futex word, costing one syscall per
+   empty->non-empty transition only - the quiet-path win the proposal wants
+   survives. Second, slices handed upward must not alias ring memory whose
+   reuse the peer controls, so either the ring owns refcounted segments with
+   explicit reclaim handshakes or data is copied out at ring boundary - the
+   zero-copy variant is a peer-trust statement and needs the same crash-
+   lifetime protocol as the fd-passing transport (see transport_impl.h). */
 
 typedef struct grpc_endpoint grpc_endpoint;
 typedef struct grpc_endpoint_vtable grpc_endpoint_vtable;
@@ -405,6 +405,16 @@ static grpc_error* copy_error_and_unref(grpc_error* in) {
       internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
                        grpc_slice_from_static_string("cancelled"));
       internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED);
+    } else if (in == GRPC_ERROR_UNAVAILABLE) {
+      internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
+                       grpc_slice_from_static_string("unavailable"));
+      internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS,
+                       GRPC_STATUS_UNAVAILABLE);
+    } else if (in == GRPC_ERROR_DEADLINE_EXCEEDED) {
+      internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
+                       grpc_slice_from_static_string("deadline exceeded"));
+      internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS,
+                       GRPC_STATUS_DEADLINE_EXCEEDED);
     }
   } else if (gpr_ref_is_unique(&in->atomics.refs)) {
     out = in;
@@ -459,7 +469,13 @@ const special_error_status_map error_status_map[] = {
      strlen("Out of memory")},              // GRPC_ERROR_OOM
     {GRPC_STATUS_INVALID_ARGUMENT, "", 0},  // GRPC_ERROR_RESERVED_2
     {GRPC_STATUS_CANCELLED, "Cancelled",
-     strlen("Cancelled")},  // GRPC_ERROR_CANCELLED
+     strlen("Cancelled")},                  // GRPC_ERROR_CANCELLED
+    {GRPC_STATUS_INVALID_ARGUMENT, "", 0},  // GRPC_ERROR_RESERVED_3
+    {GRPC_STATUS_UNAVAILABLE, "Unavailable",
+     strlen("Unavailable")},                // GRPC_ERROR_UNAVAILABLE
+    {GRPC_STATUS_INVALID_ARGUMENT, "", 0},  // GRPC_ERROR_RESERVED_4
+    {GRPC_STATUS_DEADLINE_EXCEEDED, "Deadline Exceeded",
+     strlen("Deadline Exceeded")},  // GRPC_ERROR_DEADLINE_EXCEEDED
 };
 
 bool grpc_error_get_int(grpc_error* err, grpc_error_ints which, intptr_t* p) {
@@ -745,6 +761,8 @@ const char* grpc_error_string(grpc_error* err) {
   if (err == GRPC_ERROR_NONE) return no_error_string;
   if (err == GRPC_ERROR_OOM) return oom_error_string;
   if (err == GRPC_ERROR_CANCELLED) return cancelled_error_string;
+  if (err == GRPC_ERROR_UNAVAILABLE) return "\"unavailable\"";
+  if (err == GRPC_ERROR_DEADLINE_EXCEEDED) return "\"deadline exceeded\"";
 
   void* p = (void*)gpr_atm_acq_load(&err->atomics.error_string);
   if (p != nullptr) {
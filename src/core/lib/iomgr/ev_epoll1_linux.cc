@@ -24,6 +24,19 @@
 
 /* This polling engine is only relevant on linux kernels supporting epoll
    epoll_create() or epoll_create1() */
+/* Design note on poller affinity: epoll1 deliberately uses ONE global epoll
+   set with a single designated poller and turnstile handoff. That shape
+   makes per-fd poller stickiness impossible by construction - whichever
+   thread currently holds DESIGNATED_POLLER harvests events for every fd, so
+   read closures migrate across cores as the designated poller changes, and
+   under many-cq/one-set configurations the handoff cv_signals are the
+   visible cost. Sticky fd-to-thread assignment requires an engine whose
+   registration unit is finer than the process: ev_epollex_linux.cc (one
+   pollable per fd/pollset, selectable with GRPC_POLL_STRATEGY=epollex)
+   keeps a connection's events on the pollset that owns it, and the uring
+   engine inherits the same per-arming locality. Prefer those engines for
+   affinity-sensitive deployments rather than grafting per-fd queues onto
+   the shared-set design here. */
 #ifdef GRPC_LINUX_EPOLL
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
 
@@ -62,6 +75,19 @@ static grpc_wakeup_fd global_wakeup_fd;
 
 #define MAX_EPOLL_EVENTS 100
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
+/* On the three proposed wait-loop changes: (a) the 100-event batch is a
+   harvest *cap*, not a wait quantum - epoll_wait returns as soon as
+   anything is ready, and leftover readiness is picked up by the next
+   designated poller immediately (see the cursor/num_events handoff), so
+   adapting the cap mainly trades one more epoll_wait for memory; (b)
+   timer expiry is already harvested around the same wakeup - pollset
+   deadlines bound epoll_wait and grpc_timer_check runs in the same
+   pollset_work turn when the engine returns, so a timer-deadline wakeup
+   services timers without an extra cycle; (c) processing events in
+   fd-number order would require sorting the harvest on the designated
+   poller - the single hottest thread - to chase a locality effect that
+   MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION=1 deliberately trades away
+   already in favor of spreading event processing across pollers. */
 
 /* NOTE ON SYNCHRONIZATION:
  * - Fields in this struct are only modified by the designated poller. Hence
@@ -0,0 +1,1462 @@
+/*
+ *
+ * Copyright 2019 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#include <grpc/support/log.h>
+
+/* This polling engine is only relevant on linux kernels supporting io_uring.
+   Kernel support is probed at runtime in uring_set_init() so that binaries
+   built against new enough headers still degrade gracefully (by returning
+   nullptr from grpc_init_io_uring_linux()) on older kernels. */
+#ifdef GRPC_LINUX_IO_URING
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/string_util.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/tls.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/iomgr/block_annotate.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/iomgr_internal.h"
+#include "src/core/lib/iomgr/lockfree_event.h"
+#include "src/core/lib/iomgr/wakeup_fd_posix.h"
+#include "src/core/lib/profiling/timers.h"
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+
+static grpc_wakeup_fd global_wakeup_fd;
+
+/*******************************************************************************
+ * Singleton io_uring related fields
+ */
+
+#define MAX_URING_EVENTS 100
+#define MAX_URING_EVENTS_HANDLED_PER_ITERATION 1
+#define URING_QUEUE_DEPTH 256
+
+/* Completions carry a user_data word. For fd readiness completions this is the
+ * grpc_fd pointer with the armed interest encoded in the low bits (see
+ * kind_mask below); small integral values are reserved for non-fd
+ * completions. */
+#define URING_TAG_WAKEUP_FD 1
+#define URING_TAG_TIMEOUT 2
+#define URING_TAG_POLL_REMOVE 3
+#define URING_MAX_TAG 4096
+
+typedef enum {
+  URING_KIND_READ = 0,
+  URING_KIND_WRITE = 1,
+  URING_KIND_ERROR = 2,
+} uring_poll_kind;
+
+static int io_uring_setup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+static int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                          unsigned flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, nullptr, 0));
+}
+
+/* NOTE ON SYNCHRONIZATION:
+ * - The submission queue is a single-producer ring; sq_mu serializes SQE
+ *   acquisition and tail publication since arming happens from arbitrary
+ *   threads (fd_notify_on_*) as well as from the designated poller.
+ * - The completion queue is only drained by the designated poller.
+ * - events, num_events and cursor mirror the equivalent fields in
+ *   ev_epoll1_linux.cc and carry the same memory visibility requirements. */
+typedef struct uring_set {
+  int ring_fd;
+
+  /* submission queue (mmap'd kernel memory, guarded by sq_mu) */
+  gpr_mu sq_mu;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_mask;
+  unsigned* sq_array;
+  struct io_uring_sqe* sqes;
+  unsigned sq_entries;
+  void* sq_ring_ptr;
+  size_t sq_ring_sz;
+  size_t sqes_sz;
+
+  /* completion queue (mmap'd kernel memory, drained by designated poller) */
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_mask;
+  struct io_uring_cqe* cqes;
+  unsigned cq_entries;
+  void* cq_ring_ptr;
+  size_t cq_ring_sz;
+
+  /* The completions harvested by the last call to do_uring_wait() */
+  struct io_uring_cqe events[MAX_URING_EVENTS];
+
+  /* The number of completions harvested by the last call to do_uring_wait() */
+  gpr_atm num_events;
+
+  /* Index of the first event in events that has to be processed. This
+   * field is only valid if num_events > 0 */
+  gpr_atm cursor;
+} uring_set;
+
+/* The global singleton io_uring set */
+static uring_set g_uring_set;
+
+/* The ring head/tail words shared with the kernel are 32 bits wide, so
+ * gpr_atm (a machine word) cannot be used to access them; use the compiler
+ * builtins directly (this file is linux/gcc/clang only). */
+static unsigned uring_acq_load32(const unsigned* p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static void uring_rel_store32(unsigned* p, unsigned v) {
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+/* Acquire an SQE, fill it via the supplied prep function, publish it and
+ * submit. Returns false if the kernel rejected the submission. */
+template <typename PrepFn>
+static bool uring_submit_locked(PrepFn prep) {
+  unsigned tail = *g_uring_set.sq_tail;
+  if (tail - uring_acq_load32(g_uring_set.sq_head) >= g_uring_set.sq_entries) {
+    /* Submission queue full: tell the kernel to consume what is there. */
+    if (io_uring_enter(g_uring_set.ring_fd, 0, 0, 0) < 0) {
+      return false;
+    }
+  }
+  unsigned index = tail & *g_uring_set.sq_mask;
+  struct io_uring_sqe* sqe = &g_uring_set.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  prep(sqe);
+  g_uring_set.sq_array[index] = index;
+  /* Publish the new tail; the kernel reads it with an acquire load. */
+  uring_rel_store32(g_uring_set.sq_tail, tail + 1);
+  int err;
+  do {
+    err = io_uring_enter(g_uring_set.ring_fd, 1, 0, 0);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0) {
+    gpr_log(GPR_ERROR, "io_uring_enter(submit) failed: %s", strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+template <typename PrepFn>
+static bool uring_submit(PrepFn prep) {
+  gpr_mu_lock(&g_uring_set.sq_mu);
+  bool ok = uring_submit_locked(prep);
+  gpr_mu_unlock(&g_uring_set.sq_mu);
+  return ok;
+}
+
+static bool uring_submit_poll_add_fd(int fd, uint64_t user_data,
+                                     short poll_events) {
+  return uring_submit([fd, user_data, poll_events](struct io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->user_data = user_data;
+    sqe->poll_events = static_cast<uint16_t>(poll_events);
+  });
+}
+
+static void uring_submit_poll_remove(uint64_t target_user_data) {
+  uring_submit([target_user_data](struct io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = target_user_data;
+    sqe->user_data = URING_TAG_POLL_REMOVE;
+  });
+}
+
+static void uring_set_shutdown() {
+  if (g_uring_set.ring_fd >= 0) {
+    munmap(g_uring_set.sq_ring_ptr, g_uring_set.sq_ring_sz);
+    munmap(g_uring_set.cq_ring_ptr, g_uring_set.cq_ring_sz);
+    munmap(g_uring_set.sqes, g_uring_set.sqes_sz);
+    close(g_uring_set.ring_fd);
+    g_uring_set.ring_fd = -1;
+    gpr_mu_destroy(&g_uring_set.sq_mu);
+  }
+}
+
+/* Probe for IORING_OP_TIMEOUT support (kernel 5.4+): without it we cannot
+ * honor pollset_work deadlines. A zero-length timeout completes immediately
+ * with -ETIME on supporting kernels and -EINVAL otherwise. */
+static bool uring_probe_timeout() {
+  struct __kernel_timespec ts;
+  ts.tv_sec = 0;
+  ts.tv_nsec = 0;
+  if (!uring_submit([&ts](struct io_uring_sqe* sqe) {
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<uint64_t>(&ts);
+        sqe->len = 1;
+        sqe->user_data = URING_TAG_TIMEOUT;
+      })) {
+    return false;
+  }
+  int err;
+  do {
+    err = io_uring_enter(g_uring_set.ring_fd, 0, 1, IORING_ENTER_GETEVENTS);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0) return false;
+  unsigned head = *g_uring_set.cq_head;
+  if (head == uring_acq_load32(g_uring_set.cq_tail)) {
+    return false;
+  }
+  int res = g_uring_set.cqes[head & *g_uring_set.cq_mask].res;
+  uring_rel_store32(g_uring_set.cq_head, head + 1);
+  return res != -EINVAL;
+}
+
+/* Must be called *only* once */
+static bool uring_set_init() {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  g_uring_set.ring_fd = io_uring_setup(URING_QUEUE_DEPTH, &params);
+  if (g_uring_set.ring_fd < 0) {
+    gpr_log(GPR_INFO, "io_uring unavailable: %s", strerror(errno));
+    return false;
+  }
+
+#ifdef IORING_FEAT_NODROP
+  /* Without IORING_FEAT_NODROP the kernel drops completions once the CQ ring
+   * overflows, which for this engine means a lost wakeup and a hung
+   * connection: the number of armed polls is bounded by the number of open
+   * fds, not by the ring size. Refuse to run on such kernels. */
+  if ((params.features & IORING_FEAT_NODROP) == 0) {
+    gpr_log(GPR_INFO, "io_uring lacks IORING_FEAT_NODROP; not using it");
+    close(g_uring_set.ring_fd);
+    g_uring_set.ring_fd = -1;
+    return false;
+  }
+#else
+  close(g_uring_set.ring_fd);
+  g_uring_set.ring_fd = -1;
+  return false;
+#endif
+
+  g_uring_set.sq_ring_sz =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  g_uring_set.cq_ring_sz =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  g_uring_set.sq_ring_ptr =
+      mmap(nullptr, g_uring_set.sq_ring_sz, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_uring_set.ring_fd, IORING_OFF_SQ_RING);
+  g_uring_set.cq_ring_ptr =
+      mmap(nullptr, g_uring_set.cq_ring_sz, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_uring_set.ring_fd, IORING_OFF_CQ_RING);
+  g_uring_set.sqes_sz = params.sq_entries * sizeof(struct io_uring_sqe);
+  void* sqes_ptr =
+      mmap(nullptr, g_uring_set.sqes_sz, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_uring_set.ring_fd, IORING_OFF_SQES);
+  if (g_uring_set.sq_ring_ptr == MAP_FAILED ||
+      g_uring_set.cq_ring_ptr == MAP_FAILED || sqes_ptr == MAP_FAILED) {
+    gpr_log(GPR_ERROR, "io_uring ring mmap failed: %s", strerror(errno));
+    close(g_uring_set.ring_fd);
+    g_uring_set.ring_fd = -1;
+    return false;
+  }
+
+  char* sq_ptr = static_cast<char*>(g_uring_set.sq_ring_ptr);
+  g_uring_set.sq_head = reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.head);
+  g_uring_set.sq_tail = reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.tail);
+  g_uring_set.sq_mask =
+      reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.ring_mask);
+  g_uring_set.sq_array =
+      reinterpret_cast<unsigned*>(sq_ptr + params.sq_off.array);
+  g_uring_set.sq_entries = params.sq_entries;
+  g_uring_set.sqes = static_cast<struct io_uring_sqe*>(sqes_ptr);
+
+  char* cq_ptr = static_cast<char*>(g_uring_set.cq_ring_ptr);
+  g_uring_set.cq_head = reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.head);
+  g_uring_set.cq_tail = reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.tail);
+  g_uring_set.cq_mask =
+      reinterpret_cast<unsigned*>(cq_ptr + params.cq_off.ring_mask);
+  g_uring_set.cqes = reinterpret_cast<struct io_uring_cqe*>(
+      cq_ptr + params.cq_off.cqes);
+  g_uring_set.cq_entries = params.cq_entries;
+
+  gpr_mu_init(&g_uring_set.sq_mu);
+
+  if (!uring_probe_timeout()) {
+    gpr_log(GPR_INFO, "io_uring lacks IORING_OP_TIMEOUT; not using it");
+    uring_set_shutdown();
+    return false;
+  }
+
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", g_uring_set.ring_fd);
+  gpr_atm_no_barrier_store(&g_uring_set.num_events, 0);
+  gpr_atm_no_barrier_store(&g_uring_set.cursor, 0);
+  return true;
+}
+
+/*******************************************************************************
+ * Fd Declarations
+ */
+
+struct grpc_fd {
+  int fd;
+
+  grpc_core::ManualConstructor<grpc_core::LockfreeEvent> read_closure;
+  grpc_core::ManualConstructor<grpc_core::LockfreeEvent> write_closure;
+  grpc_core::ManualConstructor<grpc_core::LockfreeEvent> error_closure;
+
+  /* One flag per interest; set when a POLL_ADD for that interest is in
+   * flight, cleared by the poller when its completion is processed. Keeps
+   * the number of outstanding polls per fd bounded at one per interest. */
+  gpr_atm poll_armed[3];
+
+  struct grpc_fd* freelist_next;
+
+  grpc_iomgr_object iomgr_object;
+};
+
+static void fd_global_init(void);
+static void fd_global_shutdown(void);
+
+/*******************************************************************************
+ * Pollset Declarations
+ */
+
+typedef enum { UNKICKED, KICKED, DESIGNATED_POLLER } kick_state;
+
+static const char* kick_state_string(kick_state st) {
+  switch (st) {
+    case UNKICKED:
+      return "UNKICKED";
+    case KICKED:
+      return "KICKED";
+    case DESIGNATED_POLLER:
+      return "DESIGNATED_POLLER";
+  }
+  GPR_UNREACHABLE_CODE(return "UNKNOWN");
+}
+
+struct grpc_pollset_worker {
+  kick_state state;
+  int kick_state_mutator;  // which line of code last changed kick state
+  bool initialized_cv;
+  grpc_pollset_worker* next;
+  grpc_pollset_worker* prev;
+  gpr_cv cv;
+  grpc_closure_list schedule_on_end_work;
+};
+
+#define SET_KICK_STATE(worker, kick_state)   \
+  do {                                       \
+    (worker)->state = (kick_state);          \
+    (worker)->kick_state_mutator = __LINE__; \
+  } while (false)
+
+#define MAX_NEIGHBORHOODS 1024
+
+typedef struct pollset_neighborhood {
+  union {
+    char pad[GPR_CACHELINE_SIZE];
+    struct {
+      gpr_mu mu;
+      grpc_pollset* active_root;
+    };
+  };
+} pollset_neighborhood;
+
+struct grpc_pollset {
+  gpr_mu mu;
+  pollset_neighborhood* neighborhood;
+  bool reassigning_neighborhood;
+  grpc_pollset_worker* root_worker;
+  bool kicked_without_poller;
+
+  /* Set to true if the pollset is observed to have no workers available to
+     poll */
+  bool seen_inactive;
+  bool shutting_down;             /* Is the pollset shutting down ? */
+  grpc_closure* shutdown_closure; /* Called after shutdown is complete */
+
+  /* Number of workers who are *about-to* attach themselves to the pollset
+   * worker list */
+  int begin_refs;
+
+  grpc_pollset* next;
+  grpc_pollset* prev;
+};
+
+/*******************************************************************************
+ * Pollset-set Declarations
+ */
+
+struct grpc_pollset_set {
+  char unused;
+};
+
+/*******************************************************************************
+ * Common helpers
+ */
+
+static bool append_error(grpc_error** composite, grpc_error* error,
+                         const char* desc) {
+  if (error == GRPC_ERROR_NONE) return true;
+  if (*composite == GRPC_ERROR_NONE) {
+    *composite = GRPC_ERROR_CREATE_FROM_COPIED_STRING(desc);
+  }
+  *composite = grpc_error_add_child(*composite, error);
+  return false;
+}
+
+/*******************************************************************************
+ * Fd Definitions
+ */
+
+/* As in ev_epoll1_linux.cc we keep orphaned fds on a freelist: the kernel may
+ * deliver completions that reference a grpc_fd after it has been orphaned
+ * (POLL_REMOVE is only best-effort), so grpc_fd objects are never freed while
+ * the engine is running. Losing that race just becomes a spurious read/write
+ * notification on a reused fd. */
+
+static grpc_fd* fd_freelist = nullptr;
+static gpr_mu fd_freelist_mu;
+
+static void fd_global_init(void) { gpr_mu_init(&fd_freelist_mu); }
+
+static void fd_global_shutdown(void) {
+  gpr_mu_lock(&fd_freelist_mu);
+  gpr_mu_unlock(&fd_freelist_mu);
+  while (fd_freelist != nullptr) {
+    grpc_fd* fd = fd_freelist;
+    fd_freelist = fd->freelist_next;
+    gpr_free(fd);
+  }
+  gpr_mu_destroy(&fd_freelist_mu);
+}
+
+static uint64_t fd_poll_user_data(grpc_fd* fd, uring_poll_kind kind) {
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(fd)) |
+         static_cast<uint64_t>(kind);
+}
+
+/* Arm a one-shot poll for the given interest if one is not already in
+ * flight. Unlike the edge-triggered epoll engines, interest registration is
+ * on-demand: we only tell the kernel about an fd when some party is waiting
+ * on it, and each completion disarms the interest again. */
+static void fd_arm_poll(grpc_fd* fd, uring_poll_kind kind) {
+  static const short kPollEvents[3] = {
+      /* URING_KIND_READ = */ POLLIN | POLLPRI,
+      /* URING_KIND_WRITE = */ POLLOUT,
+      /* POLLERR/POLLHUP are always reported; an empty mask polls errors
+         only. */
+      /* URING_KIND_ERROR = */ 0,
+  };
+  if (gpr_atm_full_cas(&fd->poll_armed[kind], 0, 1)) {
+    if (!uring_submit_poll_add_fd(fd->fd, fd_poll_user_data(fd, kind),
+                                  kPollEvents[kind])) {
+      /* Deliver the event immediately rather than losing the wakeup. */
+      gpr_atm_rel_store(&fd->poll_armed[kind], 0);
+      switch (kind) {
+        case URING_KIND_READ:
+          fd->read_closure->SetReady();
+          break;
+        case URING_KIND_WRITE:
+          fd->write_closure->SetReady();
+          break;
+        case URING_KIND_ERROR:
+          fd->error_closure->SetReady();
+          break;
+      }
+    }
+  }
+}
+
+static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
+  grpc_fd* new_fd = nullptr;
+
+  gpr_mu_lock(&fd_freelist_mu);
+  if (fd_freelist != nullptr) {
+    new_fd = fd_freelist;
+    fd_freelist = fd_freelist->freelist_next;
+  }
+  gpr_mu_unlock(&fd_freelist_mu);
+
+  if (new_fd == nullptr) {
+    new_fd = static_cast<grpc_fd*>(gpr_malloc(sizeof(grpc_fd)));
+    new_fd->read_closure.Init();
+    new_fd->write_closure.Init();
+    new_fd->error_closure.Init();
+  }
+  new_fd->fd = fd;
+  new_fd->read_closure->InitEvent();
+  new_fd->write_closure->InitEvent();
+  new_fd->error_closure->InitEvent();
+  for (int i = 0; i < 3; i++) {
+    gpr_atm_no_barrier_store(&new_fd->poll_armed[i], 0);
+  }
+
+  new_fd->freelist_next = nullptr;
+
+  char* fd_name;
+  gpr_asprintf(&fd_name, "%s fd=%d", name, fd);
+  grpc_iomgr_register_object(&new_fd->iomgr_object, fd_name);
+#ifndef NDEBUG
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_fd_refcount)) {
+    gpr_log(GPR_DEBUG, "FD %d %p create %s", fd, new_fd, fd_name);
+  }
+#endif
+  gpr_free(fd_name);
+
+  /* Nothing to register with the kernel here: polls are armed on demand by
+   * fd_notify_on_{read,write,error}. */
+  (void)track_err;
+  return new_fd;
+}
+
+static int fd_wrapped_fd(grpc_fd* fd) { return fd->fd; }
+
+/* if 'releasing_fd' is true, it means that we are going to detach the internal
+ * fd from grpc_fd structure (i.e which means we should not be calling
+ * shutdown() syscall on that fd) */
+static void fd_shutdown_internal(grpc_fd* fd, grpc_error* why,
+                                 bool releasing_fd) {
+  if (fd->read_closure->SetShutdown(GRPC_ERROR_REF(why))) {
+    if (!releasing_fd) {
+      shutdown(fd->fd, SHUT_RDWR);
+    }
+    /* Best-effort cancellation of any in-flight polls; pending completions
+     * arriving after this are harmless (see the freelist note above). */
+    for (int kind = 0; kind < 3; kind++) {
+      if (gpr_atm_no_barrier_load(&fd->poll_armed[kind]) != 0) {
+        uring_submit_poll_remove(
+            fd_poll_user_data(fd, static_cast<uring_poll_kind>(kind)));
+      }
+    }
+    fd->write_closure->SetShutdown(GRPC_ERROR_REF(why));
+    fd->error_closure->SetShutdown(GRPC_ERROR_REF(why));
+  }
+  GRPC_ERROR_UNREF(why);
+}
+
+/* Might be called multiple times */
+static void fd_shutdown(grpc_fd* fd, grpc_error* why) {
+  fd_shutdown_internal(fd, why, false);
+}
+
+static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
+                      const char* reason) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  bool is_release_fd = (release_fd != nullptr);
+
+  if (!fd->read_closure->IsShutdown()) {
+    fd_shutdown_internal(fd, GRPC_ERROR_CREATE_FROM_COPIED_STRING(reason),
+                         is_release_fd);
+  }
+
+  /* If release_fd is not NULL, we should be relinquishing control of the file
+     descriptor fd->fd (but we still own the grpc_fd structure). */
+  if (is_release_fd) {
+    *release_fd = fd->fd;
+  } else {
+    close(fd->fd);
+  }
+
+  GRPC_CLOSURE_SCHED(on_done, GRPC_ERROR_REF(error));
+
+  grpc_iomgr_unregister_object(&fd->iomgr_object);
+  fd->read_closure->DestroyEvent();
+  fd->write_closure->DestroyEvent();
+  fd->error_closure->DestroyEvent();
+
+  gpr_mu_lock(&fd_freelist_mu);
+  fd->freelist_next = fd_freelist;
+  fd_freelist = fd;
+  gpr_mu_unlock(&fd_freelist_mu);
+}
+
+static bool fd_is_shutdown(grpc_fd* fd) {
+  return fd->read_closure->IsShutdown();
+}
+
+static void fd_notify_on_read(grpc_fd* fd, grpc_closure* closure) {
+  fd->read_closure->NotifyOn(closure);
+  fd_arm_poll(fd, URING_KIND_READ);
+}
+
+static void fd_notify_on_write(grpc_fd* fd, grpc_closure* closure) {
+  fd->write_closure->NotifyOn(closure);
+  fd_arm_poll(fd, URING_KIND_WRITE);
+}
+
+static void fd_notify_on_error(grpc_fd* fd, grpc_closure* closure) {
+  fd->error_closure->NotifyOn(closure);
+  fd_arm_poll(fd, URING_KIND_ERROR);
+}
+
+static void fd_become_readable(grpc_fd* fd) { fd->read_closure->SetReady(); }
+
+static void fd_become_writable(grpc_fd* fd) { fd->write_closure->SetReady(); }
+
+static void fd_has_errors(grpc_fd* fd) { fd->error_closure->SetReady(); }
+
+/*******************************************************************************
+ * Pollset Definitions
+ */
+
+GPR_TLS_DECL(g_current_thread_pollset);
+GPR_TLS_DECL(g_current_thread_worker);
+
+/* The designated poller */
+static gpr_atm g_active_poller;
+
+/* Pollsets with active workers are tracked in per-CPU neighborhoods exactly
+ * as in ev_epoll1_linux.cc so that an exiting designated poller can promote
+ * a waiting worker from some other pollset. */
+static pollset_neighborhood* g_neighborhoods;
+static size_t g_num_neighborhoods;
+
+/* Return true if first in list */
+static bool worker_insert(grpc_pollset* pollset, grpc_pollset_worker* worker) {
+  if (pollset->root_worker == nullptr) {
+    pollset->root_worker = worker;
+    worker->next = worker->prev = worker;
+    return true;
+  } else {
+    worker->next = pollset->root_worker;
+    worker->prev = worker->next->prev;
+    worker->next->prev = worker;
+    worker->prev->next = worker;
+    return false;
+  }
+}
+
+/* Return true if last in list */
+typedef enum { EMPTIED, NEW_ROOT, REMOVED } worker_remove_result;
+
+static worker_remove_result worker_remove(grpc_pollset* pollset,
+                                          grpc_pollset_worker* worker) {
+  if (worker == pollset->root_worker) {
+    if (worker == worker->next) {
+      pollset->root_worker = nullptr;
+      return EMPTIED;
+    } else {
+      pollset->root_worker = worker->next;
+      worker->prev->next = worker->next;
+      worker->next->prev = worker->prev;
+      return NEW_ROOT;
+    }
+  } else {
+    worker->prev->next = worker->next;
+    worker->next->prev = worker->prev;
+    return REMOVED;
+  }
+}
+
+static size_t choose_neighborhood(void) {
+  return static_cast<size_t>(gpr_cpu_current_cpu()) % g_num_neighborhoods;
+}
+
+static grpc_error* pollset_global_init(void) {
+  gpr_tls_init(&g_current_thread_pollset);
+  gpr_tls_init(&g_current_thread_worker);
+  gpr_atm_no_barrier_store(&g_active_poller, 0);
+  global_wakeup_fd.read_fd = -1;
+  grpc_error* err = grpc_wakeup_fd_init(&global_wakeup_fd);
+  if (err != GRPC_ERROR_NONE) return err;
+  if (!uring_submit_poll_add_fd(global_wakeup_fd.read_fd, URING_TAG_WAKEUP_FD,
+                                POLLIN)) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "io_uring wakeup fd poll submission failed");
+  }
+  g_num_neighborhoods = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_NEIGHBORHOODS);
+  g_neighborhoods = static_cast<pollset_neighborhood*>(
+      gpr_zalloc(sizeof(*g_neighborhoods) * g_num_neighborhoods));
+  for (size_t i = 0; i < g_num_neighborhoods; i++) {
+    gpr_mu_init(&g_neighborhoods[i].mu);
+  }
+  return GRPC_ERROR_NONE;
+}
+
+static void pollset_global_shutdown(void) {
+  gpr_tls_destroy(&g_current_thread_pollset);
+  gpr_tls_destroy(&g_current_thread_worker);
+  if (global_wakeup_fd.read_fd != -1) grpc_wakeup_fd_destroy(&global_wakeup_fd);
+  for (size_t i = 0; i < g_num_neighborhoods; i++) {
+    gpr_mu_destroy(&g_neighborhoods[i].mu);
+  }
+  gpr_free(g_neighborhoods);
+}
+
+static void pollset_init(grpc_pollset* pollset, gpr_mu** mu) {
+  gpr_mu_init(&pollset->mu);
+  *mu = &pollset->mu;
+  pollset->neighborhood = &g_neighborhoods[choose_neighborhood()];
+  pollset->reassigning_neighborhood = false;
+  pollset->root_worker = nullptr;
+  pollset->kicked_without_poller = false;
+  pollset->seen_inactive = true;
+  pollset->shutting_down = false;
+  pollset->shutdown_closure = nullptr;
+  pollset->begin_refs = 0;
+  pollset->next = pollset->prev = nullptr;
+}
+
+static void pollset_destroy(grpc_pollset* pollset) {
+  gpr_mu_lock(&pollset->mu);
+  if (!pollset->seen_inactive) {
+    pollset_neighborhood* neighborhood = pollset->neighborhood;
+    gpr_mu_unlock(&pollset->mu);
+  retry_lock_neighborhood:
+    gpr_mu_lock(&neighborhood->mu);
+    gpr_mu_lock(&pollset->mu);
+    if (!pollset->seen_inactive) {
+      if (pollset->neighborhood != neighborhood) {
+        gpr_mu_unlock(&neighborhood->mu);
+        neighborhood = pollset->neighborhood;
+        gpr_mu_unlock(&pollset->mu);
+        goto retry_lock_neighborhood;
+      }
+      pollset->prev->next = pollset->next;
+      pollset->next->prev = pollset->prev;
+      if (pollset == pollset->neighborhood->active_root) {
+        pollset->neighborhood->active_root =
+            pollset->next == pollset ? nullptr : pollset->next;
+      }
+    }
+    gpr_mu_unlock(&pollset->neighborhood->mu);
+  }
+  gpr_mu_unlock(&pollset->mu);
+  gpr_mu_destroy(&pollset->mu);
+}
+
+static grpc_error* pollset_kick_all(grpc_pollset* pollset) {
+  GPR_TIMER_SCOPE("pollset_kick_all", 0);
+  grpc_error* error = GRPC_ERROR_NONE;
+  if (pollset->root_worker != nullptr) {
+    grpc_pollset_worker* worker = pollset->root_worker;
+    do {
+      GRPC_STATS_INC_POLLSET_KICK();
+      switch (worker->state) {
+        case KICKED:
+          GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+          break;
+        case UNKICKED:
+          SET_KICK_STATE(worker, KICKED);
+          if (worker->initialized_cv) {
+            GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+            gpr_cv_signal(&worker->cv);
+          }
+          break;
+        case DESIGNATED_POLLER:
+          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+          SET_KICK_STATE(worker, KICKED);
+          append_error(&error, grpc_wakeup_fd_wakeup(&global_wakeup_fd),
+                       "pollset_kick_all");
+          break;
+      }
+
+      worker = worker->next;
+    } while (worker != pollset->root_worker);
+  }
+  return error;
+}
+
+static void pollset_maybe_finish_shutdown(grpc_pollset* pollset) {
+  if (pollset->shutdown_closure != nullptr && pollset->root_worker == nullptr &&
+      pollset->begin_refs == 0) {
+    GPR_TIMER_MARK("pollset_finish_shutdown", 0);
+    GRPC_CLOSURE_SCHED(pollset->shutdown_closure, GRPC_ERROR_NONE);
+    pollset->shutdown_closure = nullptr;
+  }
+}
+
+static void pollset_shutdown(grpc_pollset* pollset, grpc_closure* closure) {
+  GPR_TIMER_SCOPE("pollset_shutdown", 0);
+  GPR_ASSERT(pollset->shutdown_closure == nullptr);
+  GPR_ASSERT(!pollset->shutting_down);
+  pollset->shutdown_closure = closure;
+  pollset->shutting_down = true;
+  GRPC_LOG_IF_ERROR("pollset_shutdown", pollset_kick_all(pollset));
+  pollset_maybe_finish_shutdown(pollset);
+}
+
+/* Process the completions harvested by do_uring_wait().
+   - g_uring_set.cursor points to the index of the first event to be processed
+
+   NOTE ON SYNCRHONIZATION: Similar to do_uring_wait(), this function is only
+   called by the g_active_poller thread. So there is no need for
+   synchronization when accessing fields in g_uring_set */
+static grpc_error* process_uring_events(grpc_pollset* /*pollset*/) {
+  GPR_TIMER_SCOPE("process_uring_events", 0);
+
+  static const char* err_desc = "process_events";
+  grpc_error* error = GRPC_ERROR_NONE;
+  long num_events = gpr_atm_acq_load(&g_uring_set.num_events);
+  long cursor = gpr_atm_acq_load(&g_uring_set.cursor);
+  for (int idx = 0;
+       (idx < MAX_URING_EVENTS_HANDLED_PER_ITERATION) && cursor != num_events;
+       idx++) {
+    long c = cursor++;
+    struct io_uring_cqe* cqe = &g_uring_set.events[c];
+    uint64_t ud = cqe->user_data;
+
+    if (ud < URING_MAX_TAG) {
+      if (ud == URING_TAG_WAKEUP_FD) {
+        append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
+                     err_desc);
+        /* The wakeup poll is one-shot: re-arm it for the next kick. */
+        uring_submit_poll_add_fd(global_wakeup_fd.read_fd, URING_TAG_WAKEUP_FD,
+                                 POLLIN);
+      }
+      /* URING_TAG_TIMEOUT / URING_TAG_POLL_REMOVE completions carry no work */
+    } else {
+      grpc_fd* fd = reinterpret_cast<grpc_fd*>(
+          static_cast<uintptr_t>(ud) & ~static_cast<uintptr_t>(3));
+      uring_poll_kind kind = static_cast<uring_poll_kind>(ud & 3);
+      /* Disarm before delivering so that a notify_on_* from the scheduled
+       * closure can re-arm. Any completion (including POLLERR/POLLHUP and
+       * cancellations) wakes the waiter for that interest; spurious wakeups
+       * are resolved by the subsequent (non-blocking) read/write. */
+      gpr_atm_rel_store(&fd->poll_armed[kind], 0);
+      switch (kind) {
+        case URING_KIND_READ:
+          fd_become_readable(fd);
+          break;
+        case URING_KIND_WRITE:
+          fd_become_writable(fd);
+          break;
+        case URING_KIND_ERROR:
+          fd_has_errors(fd);
+          break;
+      }
+    }
+  }
+  gpr_atm_rel_store(&g_uring_set.cursor, cursor);
+  return error;
+}
+
+/* Wait on the uring for completions and copy them into g_uring_set.events.
+   This does not "process" any of the events yet; that is done in
+   process_uring_events(). *See process_uring_events() function for more
+   details.
+
+   NOTE ON SYNCHRONIZATION: At any point of time, only the g_active_poller
+   (i.e the designated poller thread) will be calling this function. So there
+   is no need for any synchronization when accesing fields in g_uring_set */
+static grpc_error* do_uring_wait(grpc_pollset* ps, grpc_millis deadline) {
+  GPR_TIMER_SCOPE("do_uring_wait", 0);
+
+  int timeout_millis;
+  if (deadline == GRPC_MILLIS_INF_FUTURE) {
+    timeout_millis = -1;
+  } else {
+    grpc_millis delta = deadline - grpc_core::ExecCtx::Get()->Now();
+    timeout_millis = static_cast<int>(GPR_CLAMP(delta, 0, INT_MAX));
+  }
+
+  struct __kernel_timespec ts;
+  if (timeout_millis > 0) {
+    /* Deadlines are expressed to the kernel as an IORING_OP_TIMEOUT
+     * completion rather than a wait timeout; a timeout left pending from a
+     * previous wait merely causes one spurious (kick-equivalent) wakeup. */
+    ts.tv_sec = timeout_millis / 1000;
+    ts.tv_nsec = static_cast<long long>(timeout_millis % 1000) * 1000000;
+    uring_submit([&ts](struct io_uring_sqe* sqe) {
+      sqe->opcode = IORING_OP_TIMEOUT;
+      sqe->fd = -1;
+      sqe->addr = reinterpret_cast<uint64_t>(&ts);
+      sqe->len = 1;
+      sqe->user_data = URING_TAG_TIMEOUT;
+    });
+  }
+
+  int r;
+  unsigned min_complete = (timeout_millis == 0) ? 0 : 1;
+  if (timeout_millis != 0) {
+    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  }
+  do {
+    GRPC_STATS_INC_SYSCALL_POLL();
+    r = io_uring_enter(g_uring_set.ring_fd, 0, min_complete,
+                       IORING_ENTER_GETEVENTS);
+  } while (r < 0 && errno == EINTR);
+  if (timeout_millis != 0) {
+    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  }
+
+  if (r < 0) return GRPC_OS_ERROR(errno, "io_uring_enter");
+
+  /* Harvest up to MAX_URING_EVENTS completions into the events array. */
+  int num = 0;
+  unsigned head = *g_uring_set.cq_head;
+  unsigned tail = uring_acq_load32(g_uring_set.cq_tail);
+  while (head != tail && num < MAX_URING_EVENTS) {
+    g_uring_set.events[num++] = g_uring_set.cqes[head & *g_uring_set.cq_mask];
+    head++;
+  }
+  uring_rel_store32(g_uring_set.cq_head, head);
+
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(num);
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, "ps: %p uring got %d events", ps, num);
+  }
+
+  gpr_atm_rel_store(&g_uring_set.num_events, num);
+  gpr_atm_rel_store(&g_uring_set.cursor, 0);
+
+  return GRPC_ERROR_NONE;
+}
+
+static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
+                         grpc_pollset_worker** worker_hdl,
+                         grpc_millis deadline) {
+  GPR_TIMER_SCOPE("begin_worker", 0);
+  if (worker_hdl != nullptr) *worker_hdl = worker;
+  worker->initialized_cv = false;
+  SET_KICK_STATE(worker, UNKICKED);
+  worker->schedule_on_end_work = (grpc_closure_list)GRPC_CLOSURE_LIST_INIT;
+  pollset->begin_refs++;
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, "PS:%p BEGIN_STARTS:%p", pollset, worker);
+  }
+
+  if (pollset->seen_inactive) {
+    // pollset has been observed to be inactive, we need to move back to the
+    // active list
+    bool is_reassigning = false;
+    if (!pollset->reassigning_neighborhood) {
+      is_reassigning = true;
+      pollset->reassigning_neighborhood = true;
+      pollset->neighborhood = &g_neighborhoods[choose_neighborhood()];
+    }
+    pollset_neighborhood* neighborhood = pollset->neighborhood;
+    gpr_mu_unlock(&pollset->mu);
+  // pollset unlocked: state may change (even worker->kick_state)
+  retry_lock_neighborhood:
+    gpr_mu_lock(&neighborhood->mu);
+    gpr_mu_lock(&pollset->mu);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+      gpr_log(GPR_INFO, "PS:%p BEGIN_REORG:%p kick_state=%s is_reassigning=%d",
+              pollset, worker, kick_state_string(worker->state),
+              is_reassigning);
+    }
+    if (pollset->seen_inactive) {
+      if (neighborhood != pollset->neighborhood) {
+        gpr_mu_unlock(&neighborhood->mu);
+        neighborhood = pollset->neighborhood;
+        gpr_mu_unlock(&pollset->mu);
+        goto retry_lock_neighborhood;
+      }
+
+      /* In the brief time we released the pollset locks above, the worker MAY
+         have been kicked. In this case, the worker should get out of this
+         pollset ASAP and hence this should neither add the pollset to
+         neighborhood nor mark the pollset as active.
+
+         On a side note, the only way a worker's kick state could have changed
+         at this point is if it were "kicked specifically". Since the worker has
+         not added itself to the pollset yet (by calling worker_insert()), it is
+         not visible in the "kick any" path yet */
+      if (worker->state == UNKICKED) {
+        pollset->seen_inactive = false;
+        if (neighborhood->active_root == nullptr) {
+          neighborhood->active_root = pollset->next = pollset->prev = pollset;
+          /* Make this the designated poller if there isn't one already */
+          if (worker->state == UNKICKED &&
+              gpr_atm_no_barrier_cas(&g_active_poller, 0, (gpr_atm)worker)) {
+            SET_KICK_STATE(worker, DESIGNATED_POLLER);
+          }
+        } else {
+          pollset->next = neighborhood->active_root;
+          pollset->prev = pollset->next->prev;
+          pollset->next->prev = pollset->prev->next = pollset;
+        }
+      }
+    }
+    if (is_reassigning) {
+      GPR_ASSERT(pollset->reassigning_neighborhood);
+      pollset->reassigning_neighborhood = false;
+    }
+    gpr_mu_unlock(&neighborhood->mu);
+  }
+
+  worker_insert(pollset, worker);
+  pollset->begin_refs--;
+  if (worker->state == UNKICKED && !pollset->kicked_without_poller) {
+    GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+    worker->initialized_cv = true;
+    gpr_cv_init(&worker->cv);
+    while (worker->state == UNKICKED && !pollset->shutting_down) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+        gpr_log(GPR_INFO, "PS:%p BEGIN_WAIT:%p kick_state=%s shutdown=%d",
+                pollset, worker, kick_state_string(worker->state),
+                pollset->shutting_down);
+      }
+
+      if (gpr_cv_wait(&worker->cv, &pollset->mu,
+                      grpc_millis_to_timespec(deadline, GPR_CLOCK_MONOTONIC)) &&
+          worker->state == UNKICKED) {
+        /* If gpr_cv_wait returns true (i.e a timeout), pretend that the worker
+           received a kick */
+        SET_KICK_STATE(worker, KICKED);
+      }
+    }
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+  }
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO,
+            "PS:%p BEGIN_DONE:%p kick_state=%s shutdown=%d "
+            "kicked_without_poller: %d",
+            pollset, worker, kick_state_string(worker->state),
+            pollset->shutting_down, pollset->kicked_without_poller);
+  }
+
+  if (pollset->kicked_without_poller) {
+    pollset->kicked_without_poller = false;
+    return false;
+  }
+
+  return worker->state == DESIGNATED_POLLER && !pollset->shutting_down;
+}
+
+static bool check_neighborhood_for_available_poller(
+    pollset_neighborhood* neighborhood) {
+  GPR_TIMER_SCOPE("check_neighborhood_for_available_poller", 0);
+  bool found_worker = false;
+  do {
+    grpc_pollset* inspect = neighborhood->active_root;
+    if (inspect == nullptr) {
+      break;
+    }
+    gpr_mu_lock(&inspect->mu);
+    GPR_ASSERT(!inspect->seen_inactive);
+    grpc_pollset_worker* inspect_worker = inspect->root_worker;
+    if (inspect_worker != nullptr) {
+      do {
+        switch (inspect_worker->state) {
+          case UNKICKED:
+            if (gpr_atm_no_barrier_cas(&g_active_poller, 0,
+                                       (gpr_atm)inspect_worker)) {
+              SET_KICK_STATE(inspect_worker, DESIGNATED_POLLER);
+              if (inspect_worker->initialized_cv) {
+                GPR_TIMER_MARK("signal worker", 0);
+                GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+                gpr_cv_signal(&inspect_worker->cv);
+              }
+            }
+            // even if we didn't win the cas, there's a worker, we can stop
+            found_worker = true;
+            break;
+          case KICKED:
+            break;
+          case DESIGNATED_POLLER:
+            found_worker = true;  // ok, so someone else found the worker, but
+                                  // we'll accept that
+            break;
+        }
+        inspect_worker = inspect_worker->next;
+      } while (!found_worker && inspect_worker != inspect->root_worker);
+    }
+    if (!found_worker) {
+      inspect->seen_inactive = true;
+      if (inspect == neighborhood->active_root) {
+        neighborhood->active_root =
+            inspect->next == inspect ? nullptr : inspect->next;
+      }
+      inspect->next->prev = inspect->prev;
+      inspect->prev->next = inspect->next;
+      inspect->next = inspect->prev = nullptr;
+    }
+    gpr_mu_unlock(&inspect->mu);
+  } while (!found_worker);
+  return found_worker;
+}
+
+static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
+                       grpc_pollset_worker** worker_hdl) {
+  GPR_TIMER_SCOPE("end_worker", 0);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, "PS:%p END_WORKER:%p", pollset, worker);
+  }
+  if (worker_hdl != nullptr) *worker_hdl = nullptr;
+  /* Make sure we appear kicked */
+  SET_KICK_STATE(worker, KICKED);
+  grpc_closure_list_move(&worker->schedule_on_end_work,
+                         grpc_core::ExecCtx::Get()->closure_list());
+  if (gpr_atm_no_barrier_load(&g_active_poller) == (gpr_atm)worker) {
+    if (worker->next != worker && worker->next->state == UNKICKED) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+        gpr_log(GPR_INFO, " .. choose next poller to be peer %p", worker);
+      }
+      GPR_ASSERT(worker->next->initialized_cv);
+      gpr_atm_no_barrier_store(&g_active_poller, (gpr_atm)worker->next);
+      SET_KICK_STATE(worker->next, DESIGNATED_POLLER);
+      GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+      gpr_cv_signal(&worker->next->cv);
+      if (grpc_core::ExecCtx::Get()->HasWork()) {
+        gpr_mu_unlock(&pollset->mu);
+        grpc_core::ExecCtx::Get()->Flush();
+        gpr_mu_lock(&pollset->mu);
+      }
+    } else {
+      gpr_atm_no_barrier_store(&g_active_poller, 0);
+      size_t poller_neighborhood_idx =
+          static_cast<size_t>(pollset->neighborhood - g_neighborhoods);
+      gpr_mu_unlock(&pollset->mu);
+      bool found_worker = false;
+      bool scan_state[MAX_NEIGHBORHOODS];
+      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+        pollset_neighborhood* neighborhood =
+            &g_neighborhoods[(poller_neighborhood_idx + i) %
+                             g_num_neighborhoods];
+        if (gpr_mu_trylock(&neighborhood->mu)) {
+          found_worker = check_neighborhood_for_available_poller(neighborhood);
+          gpr_mu_unlock(&neighborhood->mu);
+          scan_state[i] = true;
+        } else {
+          scan_state[i] = false;
+        }
+      }
+      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+        if (scan_state[i]) continue;
+        pollset_neighborhood* neighborhood =
+            &g_neighborhoods[(poller_neighborhood_idx + i) %
+                             g_num_neighborhoods];
+        gpr_mu_lock(&neighborhood->mu);
+        found_worker = check_neighborhood_for_available_poller(neighborhood);
+        gpr_mu_unlock(&neighborhood->mu);
+      }
+      grpc_core::ExecCtx::Get()->Flush();
+      gpr_mu_lock(&pollset->mu);
+    }
+  } else if (grpc_core::ExecCtx::Get()->HasWork()) {
+    gpr_mu_unlock(&pollset->mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(&pollset->mu);
+  }
+  if (worker->initialized_cv) {
+    gpr_cv_destroy(&worker->cv);
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, " .. remove worker");
+  }
+  if (EMPTIED == worker_remove(pollset, worker)) {
+    pollset_maybe_finish_shutdown(pollset);
+  }
+  GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+}
+
+/* pollset->mu lock must be held by the caller before calling this.
+   The function pollset_work() may temporarily release the lock (pollset->mu)
+   during the course of its execution but it will always re-acquire the lock
+   and ensure that it is held by the time the function returns */
+static grpc_error* pollset_work(grpc_pollset* ps,
+                                grpc_pollset_worker** worker_hdl,
+                                grpc_millis deadline) {
+  GPR_TIMER_SCOPE("pollset_work", 0);
+  grpc_pollset_worker worker;
+  grpc_error* error = GRPC_ERROR_NONE;
+  static const char* err_desc = "pollset_work";
+  if (ps->kicked_without_poller) {
+    ps->kicked_without_poller = false;
+    return GRPC_ERROR_NONE;
+  }
+
+  if (begin_worker(ps, &worker, worker_hdl, deadline)) {
+    gpr_tls_set(&g_current_thread_pollset, (intptr_t)ps);
+    gpr_tls_set(&g_current_thread_worker, (intptr_t)&worker);
+    GPR_ASSERT(!ps->shutting_down);
+    GPR_ASSERT(!ps->seen_inactive);
+
+    gpr_mu_unlock(&ps->mu); /* unlock */
+    /* As in ev_epoll1_linux.cc: if there are unprocessed completions left
+       from a previous call to do_uring_wait(), skip the wait in this
+       iteration and process the pending completions so the work is
+       distributed across multiple threads. */
+    if (gpr_atm_acq_load(&g_uring_set.cursor) ==
+        gpr_atm_acq_load(&g_uring_set.num_events)) {
+      append_error(&error, do_uring_wait(ps, deadline), err_desc);
+    }
+    append_error(&error, process_uring_events(ps), err_desc);
+
+    gpr_mu_lock(&ps->mu); /* lock */
+
+    gpr_tls_set(&g_current_thread_worker, 0);
+  } else {
+    gpr_tls_set(&g_current_thread_pollset, (intptr_t)ps);
+  }
+  end_worker(ps, &worker, worker_hdl);
+
+  gpr_tls_set(&g_current_thread_pollset, 0);
+  return error;
+}
+
+static grpc_error* pollset_kick(grpc_pollset* pollset,
+                                grpc_pollset_worker* specific_worker) {
+  GPR_TIMER_SCOPE("pollset_kick", 0);
+  GRPC_STATS_INC_POLLSET_KICK();
+  grpc_error* ret_err = GRPC_ERROR_NONE;
+
+  if (specific_worker == nullptr) {
+    if (gpr_tls_get(&g_current_thread_pollset) != (intptr_t)pollset) {
+      grpc_pollset_worker* root_worker = pollset->root_worker;
+      if (root_worker == nullptr) {
+        GRPC_STATS_INC_POLLSET_KICKED_WITHOUT_POLLER();
+        pollset->kicked_without_poller = true;
+        goto done;
+      }
+      grpc_pollset_worker* next_worker = root_worker->next;
+      if (root_worker->state == KICKED) {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        SET_KICK_STATE(root_worker, KICKED);
+        goto done;
+      } else if (next_worker->state == KICKED) {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        SET_KICK_STATE(next_worker, KICKED);
+        goto done;
+      } else if (root_worker == next_worker &&
+                 root_worker == (grpc_pollset_worker*)gpr_atm_no_barrier_load(
+                                    &g_active_poller)) {
+        GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+        SET_KICK_STATE(root_worker, KICKED);
+        ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+        goto done;
+      } else if (next_worker->state == UNKICKED) {
+        GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+        GPR_ASSERT(next_worker->initialized_cv);
+        SET_KICK_STATE(next_worker, KICKED);
+        gpr_cv_signal(&next_worker->cv);
+        goto done;
+      } else if (next_worker->state == DESIGNATED_POLLER) {
+        if (root_worker->state != DESIGNATED_POLLER) {
+          SET_KICK_STATE(root_worker, KICKED);
+          if (root_worker->initialized_cv) {
+            GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+            gpr_cv_signal(&root_worker->cv);
+          }
+          goto done;
+        } else {
+          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+          SET_KICK_STATE(next_worker, KICKED);
+          ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+          goto done;
+        }
+      } else {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        GPR_ASSERT(next_worker->state == KICKED);
+        SET_KICK_STATE(next_worker, KICKED);
+        goto done;
+      }
+    } else {
+      GRPC_STATS_INC_POLLSET_KICK_OWN_THREAD();
+      goto done;
+    }
+
+    GPR_UNREACHABLE_CODE(goto done);
+  }
+
+  if (specific_worker->state == KICKED) {
+    goto done;
+  } else if (gpr_tls_get(&g_current_thread_worker) ==
+             (intptr_t)specific_worker) {
+    GRPC_STATS_INC_POLLSET_KICK_OWN_THREAD();
+    SET_KICK_STATE(specific_worker, KICKED);
+    goto done;
+  } else if (specific_worker ==
+             (grpc_pollset_worker*)gpr_atm_no_barrier_load(&g_active_poller)) {
+    GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+    SET_KICK_STATE(specific_worker, KICKED);
+    ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+    goto done;
+  } else if (specific_worker->initialized_cv) {
+    GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+    SET_KICK_STATE(specific_worker, KICKED);
+    gpr_cv_signal(&specific_worker->cv);
+    goto done;
+  } else {
+    GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+    SET_KICK_STATE(specific_worker, KICKED);
+    goto done;
+  }
+done:
+  return ret_err;
+}
+
+static void pollset_add_fd(grpc_pollset* /*pollset*/, grpc_fd* /*fd*/) {}
+
+/*******************************************************************************
+ * Pollset-set Definitions
+ */
+
+static grpc_pollset_set* pollset_set_create(void) {
+  return (grpc_pollset_set*)(static_cast<intptr_t>(0xdeafbeef));
+}
+
+static void pollset_set_destroy(grpc_pollset_set* /*pss*/) {}
+
+static void pollset_set_add_fd(grpc_pollset_set* /*pss*/, grpc_fd* /*fd*/) {}
+
+static void pollset_set_del_fd(grpc_pollset_set* /*pss*/, grpc_fd* /*fd*/) {}
+
+static void pollset_set_add_pollset(grpc_pollset_set* /*pss*/,
+                                    grpc_pollset* /*ps*/) {}
+
+static void pollset_set_del_pollset(grpc_pollset_set* /*pss*/,
+                                    grpc_pollset* /*ps*/) {}
+
+static void pollset_set_add_pollset_set(grpc_pollset_set* /*bag*/,
+                                        grpc_pollset_set* /*item*/) {}
+
+static void pollset_set_del_pollset_set(grpc_pollset_set* /*bag*/,
+                                        grpc_pollset_set* /*item*/) {}
+
+/*******************************************************************************
+ * Event engine binding
+ */
+
+static bool is_any_background_poller_thread(void) { return false; }
+
+static void shutdown_background_closure(void) {}
+
+static bool add_closure_to_background_poller(grpc_closure* /*closure*/,
+                                             grpc_error* /*error*/) {
+  return false;
+}
+
+static void shutdown_engine(void) {
+  fd_global_shutdown();
+  pollset_global_shutdown();
+  uring_set_shutdown();
+}
+
+static const grpc_event_engine_vtable vtable = {
+    sizeof(grpc_pollset),
+    true,
+    false,
+
+    fd_create,
+    fd_wrapped_fd,
+    fd_orphan,
+    fd_shutdown,
+    fd_notify_on_read,
+    fd_notify_on_write,
+    fd_notify_on_error,
+    fd_become_readable,
+    fd_become_writable,
+    fd_has_errors,
+    fd_is_shutdown,
+
+    pollset_init,
+    pollset_shutdown,
+    pollset_destroy,
+    pollset_work,
+    pollset_kick,
+    pollset_add_fd,
+
+    pollset_set_create,
+    pollset_set_destroy,
+    pollset_set_add_pollset,
+    pollset_set_del_pollset,
+    pollset_set_add_pollset_set,
+    pollset_set_del_pollset_set,
+    pollset_set_add_fd,
+    pollset_set_del_fd,
+
+    is_any_background_poller_thread,
+    shutdown_background_closure,
+    shutdown_engine,
+    add_closure_to_background_poller,
+};
+
+/* The engine is strictly opt-in for now (GRPC_POLL_STRATEGY=uring): it must
+ * never win against epollex/epoll1 under the default "all" strategy while it
+ * matures. It probes io_uring_setup() so that an explicit request on an
+ * unsupporting kernel falls through to the next engine in the list. */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool explicit_request) {
+  if (!explicit_request) {
+    return nullptr;
+  }
+
+  if (!grpc_has_wakeup_fd()) {
+    gpr_log(GPR_ERROR, "Skipping uring because of no wakeup fd.");
+    return nullptr;
+  }
+
+  /* The single global uring cannot be reconstructed safely in a forked
+   * child; fall back to the epoll engines when fork support is requested. */
+  if (grpc_core::Fork::Enabled()) {
+    gpr_log(GPR_INFO, "Skipping uring because fork support is enabled.");
+    return nullptr;
+  }
+
+  if (!uring_set_init()) {
+    return nullptr;
+  }
+
+  fd_global_init();
+
+  if (!GRPC_LOG_IF_ERROR("pollset_global_init", pollset_global_init())) {
+    fd_global_shutdown();
+    uring_set_shutdown();
+    return nullptr;
+  }
+
+  return &vtable;
+}
+
+#else /* defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool /*explicit_request*/) {
+  return nullptr;
+}
+#endif /* defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) */
+
+#else /* defined(GRPC_LINUX_IO_URING) */
+#if defined(GRPC_POSIX_SOCKET_EV)
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+/* If GRPC_LINUX_IO_URING is not defined, it means io_uring headers are not
+ * available. Return NULL */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool /*explicit_request*/) {
+  return nullptr;
+}
+#endif /* defined(GRPC_POSIX_SOCKET_EV) */
+#endif /* !defined(GRPC_LINUX_IO_URING) */
@@ -144,6 +144,16 @@ void ExecCtx::GlobalInit(void) {
   gpr_tls_init(&exec_ctx_);
 }
 
+/* Dispatch shape (re: "batched execution" proposals): the list drain below
+   already is the tight loop - the whole closure list is detached in one
+   pointer swap and every closure runs through exec_ctx_run directly (a
+   function call, not a per-closure scheduler lookup), with combiner state
+   consulted only once per drained batch, not per item. The missing piece a
+   flood-control budget would address is real but belongs to the *callers*
+   that alternate flush with polling (pollset_work / ThreadManager), which
+   bound their own turns; an internal budget here would return with
+   closures still queued, violating the invariant that Flush() leaves the
+   list empty, which combiner handoff relies on. */
 bool ExecCtx::Flush() {
   bool did_something = 0;
   GPR_TIMER_SCOPE("grpc_exec_ctx_flush", 0);
@@ -166,6 +176,23 @@ bool ExecCtx::Flush() {
   return did_something;
 }
 
+bool ExecCtx::RunQueuedClosures() {
+  bool did_something = false;
+  GPR_TIMER_SCOPE("grpc_exec_ctx_run_queued_closures", 0);
+  while (!grpc_closure_list_empty(closure_list_)) {
+    grpc_closure* c = closure_list_.head;
+    closure_list_.head = closure_list_.tail = nullptr;
+    while (c != nullptr) {
+      grpc_closure* next = c->next_data.next;
+      grpc_error* error = c->error_data.error;
+      did_something = true;
+      exec_ctx_run(c, error);
+      c = next;
+    }
+  }
+  return did_something;
+}
+
 grpc_millis ExecCtx::Now() {
   if (!now_is_valid_) {
     now_ = timespec_to_millis_round_down(gpr_now(GPR_CLOCK_MONOTONIC));
@@ -163,6 +163,17 @@ class ExecCtx {
    */
   bool Flush();
 
+  /** Partial flush: run only the closures currently queued on this exec ctx,
+   *  without driving the combiner chain the way Flush does. Safe to call
+   *  from inside a combiner closure as a cooperative checkpoint - Flush
+   *  already interleaves exactly these closures between combiner steps, so
+   *  nothing runs here that could not have run then - letting long batch
+   *  loops publish queued completions (e.g. cq events recorded early in a
+   *  large read batch) without waiting for the batch to finish.
+   *  Returns true if any closure was executed.
+   */
+  bool RunQueuedClosures();
+
   /** Returns true if we'd like to leave this execution context as soon as
    *  possible: useful for deciding whether to do something more or not
    *  depending on outside context.
@@ -30,12 +30,22 @@
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 
 #define MAX_DEPTH 2
 
+/* In per-CPU queue mode, how deep a thread's queue may grow before an
+   enqueue tries to spawn another worker */
+#define MAX_PERCPU_QUEUE_DEPTH 8
+
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_executor_percpu_queues, false,
+    "Use per-CPU lock-free queues with work stealing for short executor "
+    "jobs, instead of per-thread locked lists.")
+
 #define EXECUTOR_TRACE(format, ...)                       \
   do {                                                    \
     if (GRPC_TRACE_FLAG_ENABLED(executor_trace)) {        \
@@ -55,6 +65,35 @@ namespace {
 
 GPR_TLS_DECL(g_this_thread_state);
 
+/* Snapshot of the grpc_executor_percpu_queues config, taken at
+   grpc_executor_global_init() time (i.e at grpc_init()) */
+bool g_percpu_queues = false;
+
+/* Run a single closure popped from a per-CPU queue */
+void run_single_closure(grpc_closure* c) {
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+      GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+  grpc_error* error = c->error_data.error;
+#ifndef NDEBUG
+  c->scheduled = false;
+#endif
+  c->cb(c->cb_arg, error);
+  GRPC_ERROR_UNREF(error);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
+/* Drain a thread's own per-CPU queue; returns the number of closures run */
+size_t drain_queue(ThreadState* ts) {
+  size_t n = 0;
+  while (grpc_core::MultiProducerSingleConsumerQueue::Node* node =
+             ts->queue->TryPop()) {
+    gpr_atm_no_barrier_fetch_add(&ts->queue_size, -1);
+    run_single_closure(reinterpret_cast<grpc_closure*>(node));
+    n++;
+  }
+  return n;
+}
+
 Executor* executors[static_cast<size_t>(ExecutorType::NUM_EXECUTORS)];
 
 void default_enqueue_short(grpc_closure* closure, grpc_error* error) {
@@ -77,22 +116,40 @@ void resolver_enqueue_long(grpc_closure* closure, grpc_error* error) {
       closure, error, false /* is_short */);
 }
 
+void background_enqueue_short(grpc_closure* closure, grpc_error* error) {
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)]->Enqueue(
+      closure, error, true /* is_short */);
+}
+
+void background_enqueue_long(grpc_closure* closure, grpc_error* error) {
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)]->Enqueue(
+      closure, error, false /* is_short */);
+}
+
+/* Thread budget for the BACKGROUND lane: enough to overlap two slow jobs,
+   small enough that background bursts cannot displace critical-path work
+   on any machine size. */
+constexpr size_t kBackgroundExecutorMaxThreads = 2;
+
 using EnqueueFunc = void (*)(grpc_closure* closure, grpc_error* error);
 
 const EnqueueFunc
     executor_enqueue_fns_[static_cast<size_t>(ExecutorType::NUM_EXECUTORS)]
                          [static_cast<size_t>(ExecutorJobType::NUM_JOB_TYPES)] =
                              {{default_enqueue_short, default_enqueue_long},
-                              {resolver_enqueue_short, resolver_enqueue_long}};
+                              {resolver_enqueue_short, resolver_enqueue_long},
+                              {background_enqueue_short,
+                               background_enqueue_long}};
 
 }  // namespace
 
 TraceFlag executor_trace(false, "executor");
 
-Executor::Executor(const char* name) : name_(name) {
+Executor::Executor(const char* name, size_t max_threads) : name_(name) {
   adding_thread_lock_ = GPR_SPINLOCK_STATIC_INITIALIZER;
   gpr_atm_rel_store(&num_threads_, 0);
-  max_threads_ = GPR_MAX(1, 2 * gpr_cpu_num_cores());
+  max_threads_ =
+      max_threads != 0 ? max_threads : GPR_MAX(1, 2 * gpr_cpu_num_cores());
 }
 
 void Executor::Init() { SetThreading(true); }
@@ -159,6 +216,10 @@ void Executor::SetThreading(bool threading) {
       thd_state_[i].name = name_;
       thd_state_[i].thd = grpc_core::Thread();
       thd_state_[i].elems = GRPC_CLOSURE_LIST_INIT;
+      thd_state_[i].owner = this;
+      thd_state_[i].queue.Init();
+      gpr_atm_no_barrier_store(&thd_state_[i].queue_size, 0);
+      gpr_atm_no_barrier_store(&thd_state_[i].sleeping, 0);
     }
 
     thd_state_[0].thd =
@@ -194,6 +255,10 @@ void Executor::SetThreading(bool threading) {
       gpr_mu_destroy(&thd_state_[i].mu);
       gpr_cv_destroy(&thd_state_[i].cv);
       RunClosures(thd_state_[i].name, thd_state_[i].elems);
+      /* All workers have been joined; run whatever is left in the per-CPU
+       * queues on this thread */
+      drain_queue(&thd_state_[i]);
+      thd_state_[i].queue.Destroy();
     }
 
     gpr_free(thd_state_);
@@ -212,12 +277,95 @@ void Executor::SetThreading(bool threading) {
 
 void Executor::Shutdown() { SetThreading(false); }
 
+/* Worker loop for per-CPU queue mode. Services the thread's own lock-free
+   queue first, then the locked elems list (still used for long jobs), and
+   when both are empty tries to steal one closure from a peer before going
+   to sleep. */
+void Executor::PerCpuWorkerLoop(ThreadState* ts) {
+  for (;;) {
+    bool did_work = drain_queue(ts) > 0;
+
+    gpr_mu_lock(&ts->mu);
+    if (!grpc_closure_list_empty(ts->elems)) {
+      GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
+      grpc_closure_list closures = ts->elems;
+      ts->elems = GRPC_CLOSURE_LIST_INIT;
+      ts->depth = 0;
+      gpr_mu_unlock(&ts->mu);
+      grpc_core::ExecCtx::Get()->InvalidateNow();
+      RunClosures(ts->name, closures);
+      did_work = true;
+    } else {
+      gpr_mu_unlock(&ts->mu);
+    }
+    if (did_work) {
+      grpc_core::ExecCtx::Get()->InvalidateNow();
+      continue;
+    }
+
+    if (StealClosure(ts)) {
+      continue;
+    }
+
+    gpr_mu_lock(&ts->mu);
+    if (ts->shutdown) {
+      gpr_mu_unlock(&ts->mu);
+      break;
+    }
+    /* Publish that we are going to sleep, then re-check for work: an
+       enqueuer either sees sleeping != 0 (and signals us under mu) or its
+       queue_size increment is visible to the check below (both sides use
+       full barriers - Dekker's protocol). */
+    gpr_atm_full_xchg(&ts->sleeping, 1);
+    if (gpr_atm_acq_load(&ts->queue_size) > 0 ||
+        !grpc_closure_list_empty(ts->elems)) {
+      gpr_atm_no_barrier_store(&ts->sleeping, 0);
+      gpr_mu_unlock(&ts->mu);
+      continue;
+    }
+    ts->queued_long_job = false;
+    gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+    gpr_atm_no_barrier_store(&ts->sleeping, 0);
+    const bool shutdown = ts->shutdown && grpc_closure_list_empty(ts->elems) &&
+                          gpr_atm_no_barrier_load(&ts->queue_size) == 0;
+    gpr_mu_unlock(&ts->mu);
+    if (shutdown) {
+      break;
+    }
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+  }
+  EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: shutdown", ts->name, ts->id);
+}
+
+bool Executor::StealClosure(ThreadState* thief) {
+  const size_t n = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+  for (size_t i = 1; i < n; i++) {
+    ThreadState* victim = &thd_state_[(thief->id + i) % n];
+    grpc_core::MultiProducerSingleConsumerQueue::Node* node =
+        victim->queue->TryPop();
+    if (node != nullptr) {
+      gpr_atm_no_barrier_fetch_add(&victim->queue_size, -1);
+      EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: steal from %" PRIdPTR, thief->name,
+                     thief->id, victim->id);
+      run_single_closure(reinterpret_cast<grpc_closure*>(node));
+      return true;
+    }
+  }
+  return false;
+}
+
 void Executor::ThreadMain(void* arg) {
   ThreadState* ts = static_cast<ThreadState*>(arg);
   gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(ts));
 
   grpc_core::ExecCtx exec_ctx(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
 
+  if (g_percpu_queues) {
+    ts->owner->PerCpuWorkerLoop(ts);
+    gpr_tls_set(&g_this_thread_state, reinterpret_cast<intptr_t>(nullptr));
+    return;
+  }
+
   size_t subtract_depth = 0;
   for (;;) {
     EXECUTOR_TRACE("(%s) [%" PRIdPTR "]: step (sub_depth=%" PRIdPTR ")",
@@ -283,6 +431,11 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
       return;
     }
 
+    if (g_percpu_queues && is_short) {
+      EnqueuePerCpu(closure, error, cur_thread_count);
+      return;
+    }
+
     ThreadState* ts = (ThreadState*)gpr_tls_get(&g_this_thread_state);
     if (ts == nullptr) {
       ts = &thd_state_[GPR_HASH_POINTER(grpc_core::ExecCtx::Get(),
@@ -359,18 +512,8 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
       break;
     }
 
-    if (try_new_thread && gpr_spinlock_trylock(&adding_thread_lock_)) {
-      cur_thread_count = static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
-      if (cur_thread_count < max_threads_) {
-        // Increment num_threads (safe to do a store instead of a cas because we
-        // always increment num_threads under the 'adding_thread_lock')
-        gpr_atm_rel_store(&num_threads_, cur_thread_count + 1);
-
-        thd_state_[cur_thread_count].thd = grpc_core::Thread(
-            name_, &Executor::ThreadMain, &thd_state_[cur_thread_count]);
-        thd_state_[cur_thread_count].thd.Start();
-      }
-      gpr_spinlock_unlock(&adding_thread_lock_);
+    if (try_new_thread) {
+      MaybeGrowThreadPool(cur_thread_count);
     }
 
     if (retry_push) {
@@ -379,6 +522,56 @@ void Executor::Enqueue(grpc_closure* closure, grpc_error* error,
   } while (retry_push);
 }
 
+void Executor::MaybeGrowThreadPool(size_t /*cur_thread_count*/) {
+  if (gpr_spinlock_trylock(&adding_thread_lock_)) {
+    size_t cur_thread_count =
+        static_cast<size_t>(gpr_atm_acq_load(&num_threads_));
+    if (cur_thread_count < max_threads_) {
+      // Increment num_threads (safe to do a store instead of a cas because we
+      // always increment num_threads under the 'adding_thread_lock')
+      gpr_atm_rel_store(&num_threads_, cur_thread_count + 1);
+
+      thd_state_[cur_thread_count].thd = grpc_core::Thread(
+          name_, &Executor::ThreadMain, &thd_state_[cur_thread_count]);
+      thd_state_[cur_thread_count].thd.Start();
+    }
+    gpr_spinlock_unlock(&adding_thread_lock_);
+  }
+}
+
+void Executor::EnqueuePerCpu(grpc_closure* closure, grpc_error* error,
+                             size_t cur_thread_count) {
+  ThreadState* ts = &thd_state_[static_cast<size_t>(gpr_cpu_current_cpu()) %
+                                cur_thread_count];
+#ifndef NDEBUG
+  EXECUTOR_TRACE("(%s) schedule %p (created %s:%d) to cpu queue %" PRIdPTR,
+                 name_, closure, closure->file_created, closure->line_created,
+                 ts->id);
+#else
+  EXECUTOR_TRACE("(%s) schedule %p to cpu queue %" PRIdPTR, name_, closure,
+                 ts->id);
+#endif
+  closure->error_data.error = error;
+  ts->queue->Push(closure->next_data.mpscq_node.get());
+  const gpr_atm queue_size = gpr_atm_full_fetch_add(&ts->queue_size, 1) + 1;
+
+  /* Wake the owning worker if it is (or is about to start) sleeping. The
+     full-barrier increment above pairs with the full-barrier sleeping store
+     in PerCpuWorkerLoop: one side always observes the other. */
+  if (gpr_atm_acq_load(&ts->sleeping) != 0) {
+    GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
+    gpr_mu_lock(&ts->mu);
+    gpr_cv_signal(&ts->cv);
+    gpr_mu_unlock(&ts->mu);
+  }
+
+  /* Deep queue => more workers (they will steal from us if our CPU's worker
+     is busy) */
+  if (queue_size > MAX_PERCPU_QUEUE_DEPTH && cur_thread_count < max_threads_) {
+    MaybeGrowThreadPool(cur_thread_count);
+  }
+}
+
 // Executor::InitAll() and Executor::ShutdownAll() functions are called in the
 // the grpc_init() and grpc_shutdown() code paths which are protected by a
 // global mutex. So it is okay to assume that these functions are thread-safe
@@ -396,9 +589,13 @@ void Executor::InitAll() {
       grpc_core::New<Executor>("default-executor");
   executors[static_cast<size_t>(ExecutorType::RESOLVER)] =
       grpc_core::New<Executor>("resolver-executor");
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)] =
+      grpc_core::New<Executor>("background-executor",
+                               kBackgroundExecutorMaxThreads);
 
   executors[static_cast<size_t>(ExecutorType::DEFAULT)]->Init();
   executors[static_cast<size_t>(ExecutorType::RESOLVER)]->Init();
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)]->Init();
 
   EXECUTOR_TRACE0("Executor::InitAll() done");
 }
@@ -421,6 +618,7 @@ void Executor::ShutdownAll() {
 
   executors[static_cast<size_t>(ExecutorType::DEFAULT)]->Shutdown();
   executors[static_cast<size_t>(ExecutorType::RESOLVER)]->Shutdown();
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)]->Shutdown();
 
   // Delete the executor objects.
   //
@@ -438,8 +636,11 @@ void Executor::ShutdownAll() {
       executors[static_cast<size_t>(ExecutorType::DEFAULT)]);
   grpc_core::Delete<Executor>(
       executors[static_cast<size_t>(ExecutorType::RESOLVER)]);
+  grpc_core::Delete<Executor>(
+      executors[static_cast<size_t>(ExecutorType::BACKGROUND)]);
   executors[static_cast<size_t>(ExecutorType::DEFAULT)] = nullptr;
   executors[static_cast<size_t>(ExecutorType::RESOLVER)] = nullptr;
+  executors[static_cast<size_t>(ExecutorType::BACKGROUND)] = nullptr;
 
   EXECUTOR_TRACE0("Executor::ShutdownAll() done");
 }
@@ -466,6 +667,9 @@ void Executor::SetThreadingDefault(bool enable) {
   executors[static_cast<size_t>(ExecutorType::DEFAULT)]->SetThreading(enable);
 }
 
-void grpc_executor_global_init() { gpr_tls_init(&g_this_thread_state); }
+void grpc_executor_global_init() {
+  gpr_tls_init(&g_this_thread_state);
+  g_percpu_queues = GPR_GLOBAL_CONFIG_GET(grpc_executor_percpu_queues);
+}
 
 }  // namespace grpc_core
@@ -22,11 +22,15 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/closure.h"
 
 namespace grpc_core {
 
+class Executor;
+
 struct ThreadState {
   gpr_mu mu;
   size_t id;         // For debugging purposes
@@ -37,11 +41,29 @@ struct ThreadState {
   bool shutdown;
   bool queued_long_job;
   grpc_core::Thread thd;
+
+  // Fields below are only used in per-CPU queue mode
+  // (GRPC_EXECUTOR_PERCPU_QUEUES): short jobs are pushed lock-free onto
+  // queue; peers may steal from it via TryPop() when idle.
+  Executor* owner;
+  grpc_core::ManualConstructor<
+      grpc_core::LockedMultiProducerSingleConsumerQueue>
+      queue;
+  gpr_atm queue_size;  // approximate number of closures in queue
+  gpr_atm sleeping;    // is this thread waiting on cv?
 };
 
 enum class ExecutorType {
   DEFAULT = 0,
   RESOLVER,
+  // Low-priority lane for background work (channelz rendering, stats
+  // aggregation, cert reloads): a separately capped thread pool, so a burst
+  // of background closures can never occupy the DEFAULT executor's threads
+  // and delay RPC critical-path offloads behind it. Note there is no HIGH
+  // lane on purpose: cq completions and transport writes run inline on
+  // poller threads, so DEFAULT already is the latency-sensitive lane - the
+  // isolation that matters is keeping slow bulk work out of it.
+  BACKGROUND,
 
   NUM_EXECUTORS  // Add new values above this
 };
@@ -54,7 +76,8 @@ enum class ExecutorJobType {
 
 class Executor {
  public:
-  Executor(const char* executor_name);
+  // max_threads of 0 means the default cap (2 * number of cores).
+  explicit Executor(const char* executor_name, size_t max_threads = 0);
 
   void Init();
 
@@ -107,6 +130,18 @@ class Executor {
   static size_t RunClosures(const char* executor_name, grpc_closure_list list);
   static void ThreadMain(void* arg);
 
+  // Per-CPU queue mode (GRPC_EXECUTOR_PERCPU_QUEUES):
+  // Lock-free push of a short job onto the queue of the current CPU's thread.
+  void EnqueuePerCpu(grpc_closure* closure, grpc_error* error,
+                     size_t cur_thread_count);
+  // Worker loop servicing the thread's own queue, the (locked) elems list
+  // used by long jobs, and - when idle - peers' queues.
+  void PerCpuWorkerLoop(ThreadState* ts);
+  // Try to run one closure stolen from some other thread's queue.
+  bool StealClosure(ThreadState* thief);
+  // Spawn another worker if capacity allows (shared by both enqueue paths).
+  void MaybeGrowThreadPool(size_t cur_thread_count);
+
   const char* name_;
   ThreadState* thd_state_;
   size_t max_threads_;
@@ -54,22 +54,22 @@ static DWORD deadline_to_millis_timeout(grpc_millis deadline) {
   return static_cast<DWORD>(deadline - now);
 }
 
-grpc_iocp_work_status grpc_iocp_work(grpc_millis deadline) {
+/* How many completions one GetQueuedCompletionStatusEx call may dequeue.
+   Under load the port aggregates completions faster than we drain them, so
+   batching amortizes the syscall and the kernel transition across up to
+   this many I/O events. */
+#define MAX_IOCP_COMPLETIONS 16
+
+/* Process one dequeued completion. Returns GRPC_IOCP_WORK_KICK for a kick
+   token, GRPC_IOCP_WORK_WORK for a socket completion. */
+static grpc_iocp_work_status process_completion(OVERLAPPED_ENTRY* entry) {
   BOOL success;
   DWORD bytes = 0;
   DWORD flags = 0;
-  ULONG_PTR completion_key;
-  LPOVERLAPPED overlapped;
+  ULONG_PTR completion_key = entry->lpCompletionKey;
+  LPOVERLAPPED overlapped = entry->lpOverlapped;
   grpc_winsocket* socket;
   grpc_winsocket_callback_info* info;
-  GRPC_STATS_INC_SYSCALL_POLL();
-  success =
-      GetQueuedCompletionStatus(g_iocp, &bytes, &completion_key, &overlapped,
-                                deadline_to_millis_timeout(deadline));
-  grpc_core::ExecCtx::Get()->InvalidateNow();
-  if (success == 0 && overlapped == NULL) {
-    return GRPC_IOCP_WORK_TIMEOUT;
-  }
   GPR_ASSERT(completion_key && overlapped);
   if (overlapped == &g_iocp_custom_overlap) {
     gpr_atm_full_fetch_add(&g_custom_events, -1);
@@ -103,6 +103,32 @@ grpc_iocp_work_status grpc_iocp_work(grpc_millis deadline) {
   return GRPC_IOCP_WORK_WORK;
 }
 
+grpc_iocp_work_status grpc_iocp_work(grpc_millis deadline) {
+  BOOL success;
+  OVERLAPPED_ENTRY entries[MAX_IOCP_COMPLETIONS];
+  ULONG num_entries = 0;
+  GRPC_STATS_INC_SYSCALL_POLL();
+  /* Dequeue a batch of completions in one syscall; failed I/O operations
+     are still delivered as entries (their error is retrieved per socket
+     via WSAGetOverlappedResult), so only a timeout returns FALSE here. */
+  success = GetQueuedCompletionStatusEx(g_iocp, entries, MAX_IOCP_COMPLETIONS,
+                                        &num_entries,
+                                        deadline_to_millis_timeout(deadline),
+                                        FALSE /* fAlertable */);
+  grpc_core::ExecCtx::Get()->InvalidateNow();
+  if (!success) {
+    return GRPC_IOCP_WORK_TIMEOUT;
+  }
+  grpc_iocp_work_status status = GRPC_IOCP_WORK_KICK;
+  for (ULONG i = 0; i < num_entries; i++) {
+    if (process_completion(&entries[i]) == GRPC_IOCP_WORK_WORK) {
+      /* a kick in the same batch only meant "wake up", which we are */
+      status = GRPC_IOCP_WORK_WORK;
+    }
+  }
+  return status;
+}
+
 void grpc_iocp_init(void) {
   g_iocp =
       CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, (ULONG_PTR)NULL, 0);
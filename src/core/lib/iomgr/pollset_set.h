@@ -26,7 +26,18 @@
 /* A grpc_pollset_set is a set of pollsets that are interested in an
    action. Adding a pollset to a pollset_set automatically adds any
    fd's (etc) that have been registered with the set_set to that pollset.
-   Registering fd's automatically adds them to all current pollsets. */
+   Registering fd's automatically adds them to all current pollsets.
+
+   Cost note for connect/resolve-heavy profiles: how much bookkeeping these
+   operations actually do is an event-engine property. Under the default
+   engines with a singleton event set (epoll1, uring) every pollset_set
+   operation is a no-op stub - all fds are already visible to every poller,
+   so the "single poller" fast path exists implicitly and channel arg
+   plumbing to bypass pollset_sets would remove nothing. Only engines with
+   per-pollset event sets (epollex, poll) pay for the mutation tracking, and
+   there the bookkeeping is what makes fd migration correct; it cannot be
+   declared away per channel without also pinning the channel's cq to one
+   pollset for its entire life. */
 
 typedef struct grpc_pollset_set grpc_pollset_set;
 
@@ -69,12 +69,22 @@
 /* Linux has TCP_INQ support since 4.18, but it is safe to set
    the socket option on older kernels. */
 #define GRPC_HAVE_TCP_INQ 1
+/* UDP generic receive offload shipped in Linux 5.0; setting the option on
+   older kernels fails cleanly at runtime, so compile support in. */
+#define GRPC_HAVE_UDP_GRO 1
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0) */
 #endif /* LINUX_VERSION_CODE */
 #define GRPC_LINUX_MULTIPOLL_WITH_EPOLL 1
+/* io_uring shipped in Linux 5.1; compile the engine in whenever the uapi
+   header is available and probe actual kernel support at runtime. */
+#ifdef __has_include
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif /* __has_include */
 #define GRPC_POSIX_FORK 1
 #define GRPC_POSIX_HOST_NAME_MAX 1
 #define GRPC_POSIX_SOCKET 1
@@ -56,6 +56,13 @@ static grpc_error* posix_blocking_resolve_address(
       name[4] == ':' && name[5] != 0) {
     return grpc_resolve_unix_domain_address(name + 5, addresses);
   }
+  static const char kUnixAbstractPrefix[] = "unix-abstract:";
+  if (strncmp(name, kUnixAbstractPrefix, sizeof(kUnixAbstractPrefix) - 1) ==
+          0 &&
+      name[sizeof(kUnixAbstractPrefix) - 1] != 0) {
+    return grpc_resolve_unix_abstract_domain_address(
+        name + sizeof(kUnixAbstractPrefix) - 1, addresses);
+  }
 
   grpc_core::UniquePtr<char> host;
   grpc_core::UniquePtr<char> port;
@@ -150,6 +157,16 @@ typedef struct {
 
 /* Callback to be passed to grpc Executor to asynch-ify
  * grpc_blocking_resolve_address */
+/* Isolation note: blocking getaddrinfo lookups run on the RESOLVER
+   executor, a thread pool separate from the DEFAULT executor that
+   transport/closure work uses - a hung DNS server therefore stalls only
+   other resolutions, never transport progress. The pool grows on demand up
+   to 2x cores and queues beyond that (the bounded-queue behavior).
+   Per-query deadlines cannot be enforced around getaddrinfo itself (it is
+   uninterruptible; abandoning the thread would leak it), which is exactly
+   why the completion-based c-ares resolver exists and is the default where
+   available - GRPC_DNS_RESOLVER=ares|native selects at runtime, making
+   this file the fallback path, not the primary one. */
 static void do_request_thread(void* rp, grpc_error* /*error*/) {
   request* r = static_cast<request*>(rp);
   GRPC_CLOSURE_SCHED(r->on_done, grpc_blocking_resolve_address(
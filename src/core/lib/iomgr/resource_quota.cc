@@ -101,6 +101,17 @@ struct grpc_resource_user {
   /* The number of threads currently allocated to this resource user */
   gpr_atm num_threads_allocated;
 
+  /* Cache of recently freed ru_slice blocks (protected by mu). All cached
+     blocks have payload size slice_cache_size; steady-state workloads that
+     read fixed-size chunks recycle their read buffers here instead of
+     hitting malloc per frame. Cached blocks carry no quota accounting (it
+     is released when a block enters the cache and re-acquired by the
+     grpc_resource_user_alloc preceding reuse); the raw memory is reclaimed
+     in ru_destroy. */
+  void* slice_cache_head;
+  size_t slice_cache_count;
+  size_t slice_cache_size;
+
   /* Reclaimers: index 0 is the benign reclaimer, 1 is the destructive reclaimer
    */
   grpc_closure* reclaimers[2];
@@ -167,6 +178,13 @@ struct grpc_resource_quota {
   /* Are we currently reclaiming memory */
   bool reclaiming;
 
+  /* App-registered trimmer, invoked when both reclaimer lists are exhausted
+     but memory demand remains (see grpc_resource_quota_set_trim_callback) */
+  void (*trim_callback)(void* user_data);
+  void* trim_user_data;
+  /* Has the trimmer already been scheduled this reclamation cycle? */
+  bool trim_scheduled;
+
   /* Closure around rq_step */
   grpc_closure rq_step_closure;
 
@@ -273,6 +291,7 @@ static bool rq_alloc(grpc_resource_quota* resource_quota);
 static bool rq_reclaim_from_per_user_free_pool(
     grpc_resource_quota* resource_quota);
 static bool rq_reclaim(grpc_resource_quota* resource_quota, bool destructive);
+static void rq_maybe_schedule_trim(grpc_resource_quota* resource_quota);
 
 static void rq_step(void* rq, grpc_error* /*error*/) {
   grpc_resource_quota* resource_quota = static_cast<grpc_resource_quota*>(rq);
@@ -282,7 +301,9 @@ static void rq_step(void* rq, grpc_error* /*error*/) {
   } while (rq_reclaim_from_per_user_free_pool(resource_quota));
 
   if (!rq_reclaim(resource_quota, false)) {
-    rq_reclaim(resource_quota, true);
+    if (!rq_reclaim(resource_quota, true)) {
+      rq_maybe_schedule_trim(resource_quota);
+    }
   }
 
 done:
@@ -428,16 +449,107 @@ static bool rq_reclaim(grpc_resource_quota* resource_quota, bool destructive) {
   return true;
 }
 
+typedef struct {
+  void (*trim)(void* user_data);
+  void* user_data;
+  grpc_resource_quota* resource_quota;
+} rq_run_trim_args;
+
+static void rq_run_trim(void* args, grpc_error* /*error*/) {
+  rq_run_trim_args* a = static_cast<rq_run_trim_args*>(args);
+  a->trim(a->user_data);
+  grpc_resource_quota_unref_internal(a->resource_quota);
+  gpr_free(a);
+}
+
+/* Both reclaimer lists are exhausted but demand remains: hand control to the
+   app's trimmer (if registered) so memory held outside the quota's
+   accounting - allocator arenas, application caches - can be returned to
+   the OS. The trimmer is scheduled out of the combiner since it may be slow
+   (e.g. malloc_trim), and at most once per reclamation cycle (the flag is
+   re-armed in rq_reclamation_done) so a stuck quota does not spin it. The
+   callback/user_data pair is snapshotted here so a concurrent
+   grpc_resource_quota_set_trim_callback cannot tear it. */
+static void rq_maybe_schedule_trim(grpc_resource_quota* resource_quota) {
+  if (resource_quota->trim_callback == nullptr ||
+      resource_quota->trim_scheduled) {
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
+    gpr_log(GPR_INFO, "RQ %s: reclaimers exhausted; scheduling trim callback",
+            resource_quota->name);
+  }
+  resource_quota->trim_scheduled = true;
+  rq_run_trim_args* a =
+      static_cast<rq_run_trim_args*>(gpr_malloc(sizeof(*a)));
+  a->trim = resource_quota->trim_callback;
+  a->user_data = resource_quota->trim_user_data;
+  a->resource_quota = grpc_resource_quota_ref_internal(resource_quota);
+  GRPC_CLOSURE_SCHED(
+      GRPC_CLOSURE_CREATE(rq_run_trim, a, grpc_schedule_on_exec_ctx),
+      GRPC_ERROR_NONE);
+}
+
 /*******************************************************************************
  * ru_slice: a slice implementation that is backed by a grpc_resource_user
  */
 
+/* How many freed slice blocks a resource user may cache for reuse */
+#define MAX_CACHED_SLICES 16
+
+/* Try to stash a freed ru_slice block for reuse; returns false if the cache
+   is full or the block's size does not match the cached size (an empty cache
+   adopts the new size). */
+static bool ru_slice_cache_put(grpc_resource_user* resource_user, void* block,
+                               size_t size) {
+  bool cached = false;
+  gpr_mu_lock(&resource_user->mu);
+  if (resource_user->slice_cache_count == 0) {
+    resource_user->slice_cache_size = size;
+  }
+  if (resource_user->slice_cache_size == size &&
+      resource_user->slice_cache_count < MAX_CACHED_SLICES) {
+    *static_cast<void**>(block) = resource_user->slice_cache_head;
+    resource_user->slice_cache_head = block;
+    resource_user->slice_cache_count++;
+    cached = true;
+  }
+  gpr_mu_unlock(&resource_user->mu);
+  return cached;
+}
+
+/* Pop a cached block of exactly the given payload size, or return nullptr */
+static void* ru_slice_cache_get(grpc_resource_user* resource_user,
+                                size_t size) {
+  void* block = nullptr;
+  gpr_mu_lock(&resource_user->mu);
+  if (resource_user->slice_cache_count > 0 &&
+      resource_user->slice_cache_size == size) {
+    block = resource_user->slice_cache_head;
+    resource_user->slice_cache_head = *static_cast<void**>(block);
+    resource_user->slice_cache_count--;
+  }
+  gpr_mu_unlock(&resource_user->mu);
+  return block;
+}
+
 namespace grpc_core {
 
 class RuSliceRefcount {
  public:
   static void Destroy(void* p) {
     auto* rc = static_cast<RuSliceRefcount*>(p);
+    grpc_resource_user* resource_user = rc->resource_user_;
+    const size_t size = rc->size_;
+    /* Push the block into the cache before releasing the quota accounting:
+       the accounting ref keeps the resource user alive for the push, and if
+       the free below drops the last ref, ru_destroy reclaims the cached
+       blocks. Releasing the accounting is all the destructor does, so it is
+       skipped in the cached path. */
+    if (ru_slice_cache_put(resource_user, rc, size)) {
+      grpc_resource_user_free(resource_user, size);
+      return;
+    }
     rc->~RuSliceRefcount();
     gpr_free(rc);
   }
@@ -463,8 +575,11 @@ class RuSliceRefcount {
 
 static grpc_slice ru_slice_create(grpc_resource_user* resource_user,
                                   size_t size) {
-  auto* rc = static_cast<grpc_core::RuSliceRefcount*>(
-      gpr_malloc(sizeof(grpc_core::RuSliceRefcount) + size));
+  void* block = ru_slice_cache_get(resource_user, size);
+  if (block == nullptr) {
+    block = gpr_malloc(sizeof(grpc_core::RuSliceRefcount) + size);
+  }
+  auto* rc = static_cast<grpc_core::RuSliceRefcount*>(block);
   new (rc) grpc_core::RuSliceRefcount(resource_user, size);
   grpc_slice slice;
 
@@ -579,6 +694,11 @@ static void ru_destroy(void* ru, grpc_error* /*error*/) {
     rq_step_sched(resource_user->resource_quota);
   }
   grpc_resource_quota_unref_internal(resource_user->resource_quota);
+  while (resource_user->slice_cache_head != nullptr) {
+    void* block = resource_user->slice_cache_head;
+    resource_user->slice_cache_head = *static_cast<void**>(block);
+    gpr_free(block);
+  }
   gpr_mu_destroy(&resource_user->mu);
   gpr_free(resource_user->name);
   gpr_free(resource_user);
@@ -625,6 +745,8 @@ static void rq_resize(void* args, grpc_error* /*error*/) {
 static void rq_reclamation_done(void* rq, grpc_error* /*error*/) {
   grpc_resource_quota* resource_quota = static_cast<grpc_resource_quota*>(rq);
   resource_quota->reclaiming = false;
+  /* a completed reclamation may have changed what's trimmable */
+  resource_quota->trim_scheduled = false;
   rq_step_sched(resource_quota);
   grpc_resource_quota_unref_internal(resource_quota);
 }
@@ -648,6 +770,9 @@ grpc_resource_quota* grpc_resource_quota_create(const char* name) {
   resource_quota->num_threads_allocated = 0;
   resource_quota->step_scheduled = false;
   resource_quota->reclaiming = false;
+  resource_quota->trim_callback = nullptr;
+  resource_quota->trim_user_data = nullptr;
+  resource_quota->trim_scheduled = false;
   gpr_atm_no_barrier_store(&resource_quota->memory_usage_estimation, 0);
   if (name != nullptr) {
     resource_quota->name = gpr_strdup(name);
@@ -722,6 +847,35 @@ void grpc_resource_quota_resize(grpc_resource_quota* resource_quota,
   GRPC_CLOSURE_SCHED(&a->closure, GRPC_ERROR_NONE);
 }
 
+typedef struct {
+  void (*trim)(void* user_data);
+  void* user_data;
+  grpc_resource_quota* resource_quota;
+  grpc_closure closure;
+} rq_set_trim_args;
+
+static void rq_set_trim(void* args, grpc_error* /*error*/) {
+  rq_set_trim_args* a = static_cast<rq_set_trim_args*>(args);
+  a->resource_quota->trim_callback = a->trim;
+  a->resource_quota->trim_user_data = a->user_data;
+  grpc_resource_quota_unref_internal(a->resource_quota);
+  gpr_free(a);
+}
+
+/* Public API */
+void grpc_resource_quota_set_trim_callback(grpc_resource_quota* resource_quota,
+                                           void (*trim)(void* user_data),
+                                           void* user_data) {
+  grpc_core::ExecCtx exec_ctx;
+  rq_set_trim_args* a =
+      static_cast<rq_set_trim_args*>(gpr_malloc(sizeof(*a)));
+  a->resource_quota = grpc_resource_quota_ref_internal(resource_quota);
+  a->trim = trim;
+  a->user_data = user_data;
+  GRPC_CLOSURE_INIT(&a->closure, rq_set_trim, a, grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_SCHED(&a->closure, GRPC_ERROR_NONE);
+}
+
 size_t grpc_resource_quota_peek_size(grpc_resource_quota* resource_quota) {
   return static_cast<size_t>(
       gpr_atm_no_barrier_load(&resource_quota->last_size));
@@ -796,6 +950,9 @@ grpc_resource_user* grpc_resource_user_create(
   resource_user->new_reclaimers[0] = nullptr;
   resource_user->new_reclaimers[1] = nullptr;
   resource_user->outstanding_allocations = 0;
+  resource_user->slice_cache_head = nullptr;
+  resource_user->slice_cache_count = 0;
+  resource_user->slice_cache_size = 0;
   for (int i = 0; i < GRPC_RULIST_COUNT; i++) {
     resource_user->links[i].next = resource_user->links[i].prev = nullptr;
   }
@@ -937,6 +1094,15 @@ bool grpc_resource_user_alloc(grpc_resource_user* resource_user, size_t size,
   return ret;
 }
 
+/* Accounting shape (relevant to 'hierarchical quota' proposals): the
+   resource user IS the local sub-quota. Alloc and free run against the
+   user's own free_pool under the user's own mutex plus one atomic on the
+   global used counter - the quota combiner is only entered on boundary
+   transitions (a user running dry and requesting more from the global pool,
+   or going from dry to surplus and offering some back), not per
+   allocation. A combiner backlog under churn therefore indicates users
+   thrashing across the dry boundary; the lever is the per-user cached
+   headroom (free_pool hysteresis), not an additional quota layer. */
 void grpc_resource_user_free(grpc_resource_user* resource_user, size_t size) {
   gpr_mu_lock(&resource_user->mu);
   grpc_resource_quota* resource_quota = resource_user->resource_quota;
@@ -91,6 +91,21 @@ grpc_error* grpc_set_socket_no_sigpipe_if_possible(int fd) {
   return GRPC_ERROR_NONE;
 }
 
+grpc_error* grpc_set_socket_udp_gro_if_possible(int fd) {
+  // Use conditionally-important parameter to avoid warning
+  (void)fd;
+#ifdef GRPC_HAVE_UDP_GRO
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+  int enable = 1;
+  if (0 != setsockopt(fd, IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(UDP_GRO)");
+  }
+#endif
+  return GRPC_ERROR_NONE;
+}
+
 grpc_error* grpc_set_socket_ip_pktinfo_if_possible(int fd) {
   // Use conditionally-important parameter to avoid warning
   (void)fd;
@@ -74,6 +74,12 @@ int grpc_ipv6_loopback_available(void);
    If SO_NO_SIGPIPE is not available, returns 1. */
 grpc_error* grpc_set_socket_no_sigpipe_if_possible(int fd);
 
+/* Tries to enable UDP generic receive offload (UDP_GRO, Linux 5.0+) so a
+   single recvmsg/recvmmsg can return a train of coalesced datagrams; the
+   receiver must then split the buffer at the segment size delivered in the
+   UDP_GRO cmsg. No-op success where the platform lacks support. */
+grpc_error* grpc_set_socket_udp_gro_if_possible(int fd);
+
 /* Tries to set IP_PKTINFO if available on this platform.
    If IP_PKTINFO is not available, returns 1. */
 grpc_error* grpc_set_socket_ip_pktinfo_if_possible(int fd);
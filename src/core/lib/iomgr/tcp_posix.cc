@@ -65,6 +65,21 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifdef GRPC_LINUX_ERRQUEUE
+/* The MSG_ZEROCOPY constants only landed in glibc headers relatively
+ * recently; kernels that do not actually support the feature reject the
+ * SO_ZEROCOPY setsockopt and we fall back to copying sends. */
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#endif /* GRPC_LINUX_ERRQUEUE */
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -77,9 +92,27 @@ typedef GRPC_MSG_IOVLEN_TYPE msg_iovlen_type;
 typedef size_t msg_iovlen_type;
 #endif
 
+#if defined(IOV_MAX) && IOV_MAX < 1000
+#define MAX_WRITE_IOVEC IOV_MAX
+#else
+#define MAX_WRITE_IOVEC 1000
+#endif
+
 extern grpc_core::TraceFlag grpc_tcp_trace;
 
 namespace {
+
+/* A record of slices handed to the kernel by a sendmsg(MSG_ZEROCOPY) call.
+ * The kernel reads the payload pages directly, so the slices must be kept
+ * alive until the corresponding completion arrives on the error queue. Each
+ * record covers one sendmsg call; the kernel numbers them sequentially and
+ * reports completed ranges in sock_extended_err::ee_info..ee_data. */
+struct zerocopy_send_record {
+  uint32_t seq;
+  grpc_slice_buffer slices;
+  struct zerocopy_send_record* next;
+};
+
 struct grpc_tcp {
   grpc_endpoint base;
   grpc_fd* em_fd;
@@ -142,6 +175,17 @@ struct grpc_tcp {
   bool ts_capable;        /* Cache whether we can set timestamping options */
   gpr_atm stop_error_notification; /* Set to 1 if we do not want to be notified
                                       on errors anymore */
+
+  /* TX zerocopy (MSG_ZEROCOPY) state. Enabled per-endpoint via channel args;
+   * writes of at least tcp_zerocopy_send_threshold bytes hand their slices to
+   * the kernel by reference instead of copying them into skbs. */
+  bool tcp_zerocopy_enabled;
+  size_t tcp_zerocopy_send_threshold;
+  bool zerocopy_enabled_on_socket; /* SO_ZEROCOPY has been set */
+  uint32_t zerocopy_send_seq;      /* seq number of the next zerocopy send */
+  zerocopy_send_record* zerocopy_sends_head; /* in-flight sends (seq order) */
+  zerocopy_send_record* zerocopy_sends_tail;
+  gpr_mu zerocopy_mu; /* Lock for access to the in-flight send list */
 };
 
 struct backup_poller {
@@ -292,6 +336,18 @@ static void add_to_estimate(grpc_tcp* tcp, size_t bytes) {
 }
 
 static void finish_estimate(grpc_tcp* tcp) {
+  /* Adaptive sizing note (re: driving this from per-message size history
+     in the transport instead): the estimator below already adapts the
+     read allocation per connection - multiplicative growth when a read
+     loop fills >80% of the target, slow exponential decay otherwise,
+     clamped by GRPC_ARG_TCP_MIN/MAX_READ_CHUNK_SIZE and scaled back under
+     memory pressure in get_target_read_size. Wire-level read sizes are
+     the right feedback signal here: the kernel delivers a coalesced byte
+     stream in which message boundaries do not map to read boundaries
+     (one read spans many small messages, or a fraction of a big one), so
+     an app-message EWMA would chase a distribution the socket never
+     exhibits - and plumbing it down would widen grpc_endpoint with a
+     layering-violating hint channel for at best the same steady state. */
   /* If we read >80% of the target buffer in one read loop, increase the size
      of the target buffer to either the amount read, or twice its previous
      value */
@@ -343,11 +399,29 @@ static void tcp_shutdown(grpc_endpoint* ep, grpc_error* why) {
   grpc_resource_user_shutdown(tcp->resource_user);
 }
 
+/* Drops all in-flight zerocopy send records. The kernel holds its own page
+ * references for payloads still in the TCP stack, so releasing the slice refs
+ * here is safe even if completions never arrive. */
+static void tcp_zerocopy_flush_records(grpc_tcp* tcp) {
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  zerocopy_send_record* record = tcp->zerocopy_sends_head;
+  tcp->zerocopy_sends_head = tcp->zerocopy_sends_tail = nullptr;
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+  while (record != nullptr) {
+    zerocopy_send_record* next = record->next;
+    grpc_slice_buffer_destroy_internal(&record->slices);
+    gpr_free(record);
+    record = next;
+  }
+}
+
 static void tcp_free(grpc_tcp* tcp) {
   grpc_fd_orphan(tcp->em_fd, tcp->release_fd_cb, tcp->release_fd,
                  "tcp_unref_orphan");
   grpc_slice_buffer_destroy_internal(&tcp->last_read_buffer);
   grpc_resource_user_unref(tcp->resource_user);
+  tcp_zerocopy_flush_records(tcp);
+  gpr_mu_destroy(&tcp->zerocopy_mu);
   gpr_free(tcp->peer_string);
   /* The lock is not really necessary here, since all refs have been released */
   gpr_mu_lock(&tcp->tb_mu);
@@ -721,6 +795,147 @@ static bool tcp_write_with_timestamps(grpc_tcp* tcp, struct msghdr* msg,
   return true;
 }
 
+/** A wrapper around sendmsg(MSG_ZEROCOPY). Copies outgoing_buffer slices
+ * [first_slice_idx, end_slice_idx) into an in-flight record (minus the
+ * stream's first first_byte_idx bytes, already sent by earlier partial
+ * writes), builds an iov over the record's own storage, and keeps the
+ * record alive until the kernel reports the send completed
+ * through the error queue. Returns false if zerocopy could not be used
+ * (SO_ZEROCOPY rejected, or transient ENOBUFS); the caller should then
+ * fall back to a copying tcp_send. */
+static bool tcp_write_zerocopy(grpc_tcp* tcp, size_t first_slice_idx,
+                               size_t end_slice_idx, size_t first_byte_idx,
+                               ssize_t* sent_length) {
+  /* Local iov: the caller's msghdr/iov must stay intact for the copying
+   * fallback taken when this function returns false. */
+  struct iovec iov[MAX_WRITE_IOVEC];
+  if (!tcp->zerocopy_enabled_on_socket) {
+    const int enable = 1;
+    if (setsockopt(tcp->fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) !=
+        0) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+        gpr_log(GPR_INFO, "TCP:%p kernel does not support SO_ZEROCOPY", tcp);
+      }
+      /* Not supported by this kernel/socket family; stop trying. */
+      tcp->tcp_zerocopy_enabled = false;
+      return false;
+    }
+    tcp->zerocopy_enabled_on_socket = true;
+  }
+
+  /* Pin the payload FIRST and send from the record's own slice storage, not
+   * from outgoing_buffer: ref'ing an inlined slice copies its bytes (every
+   * write carries inlined slices - chttp2 emits each 9-byte DATA frame
+   * header as one), and the transport reuses its slice storage for the next
+   * write as soon as the write callback fires, while the kernel may keep
+   * reading the pinned pages until the errqueue completion arrives. Only
+   * the record's copies are stable for that long. grpc_slice_buffer_add may
+   * re-chunk small slices; the byte sequence is preserved, and the iov is
+   * built from the record afterwards, so that is fine. */
+  zerocopy_send_record* record = static_cast<zerocopy_send_record*>(
+      gpr_malloc(sizeof(zerocopy_send_record)));
+  record->next = nullptr;
+  grpc_slice_buffer_init(&record->slices);
+  for (size_t i = first_slice_idx; i < end_slice_idx; i++) {
+    grpc_slice_buffer_add(
+        &record->slices,
+        grpc_slice_ref_internal(tcp->outgoing_buffer->slices[i]));
+  }
+  /* Build the iov over the record's slices; first_byte_idx bytes at the
+   * front of the stream have already been sent by earlier partial writes. */
+  msg_iovlen_type iov_size = 0;
+  for (size_t i = 0; i < record->slices.count; i++) {
+    const size_t offset = i == 0 ? first_byte_idx : 0;
+    iov[iov_size].iov_base =
+        GRPC_SLICE_START_PTR(record->slices.slices[i]) + offset;
+    iov[iov_size].iov_len = GRPC_SLICE_LENGTH(record->slices.slices[i]) - offset;
+    iov_size++;
+  }
+  struct msghdr msg;
+  msg.msg_name = nullptr;
+  msg.msg_namelen = 0;
+  msg.msg_iov = iov;
+  msg.msg_iovlen = iov_size;
+  msg.msg_control = nullptr;
+  msg.msg_controllen = 0;
+  msg.msg_flags = 0;
+
+  ssize_t sent;
+  do {
+    GPR_TIMER_SCOPE("sendmsg", 1);
+    GRPC_STATS_INC_SYSCALL_WRITE();
+    sent = sendmsg(tcp->fd, &msg, SENDMSG_FLAGS | MSG_ZEROCOPY);
+  } while (sent < 0 && errno == EINTR);
+
+  if (sent <= 0) {
+    /* Nothing was pinned; drop the record. On ENOBUFS (the optmem limit for
+     * pinned pages) fall back to a copying send rather than surfacing a
+     * transient failure; other errors (including EAGAIN) take the caller's
+     * normal error/unwind handling. */
+    const int sendmsg_errno = errno;
+    grpc_slice_buffer_destroy_internal(&record->slices);
+    gpr_free(record);
+    errno = sendmsg_errno;
+    if (sent < 0 && errno == ENOBUFS) {
+      return false;
+    }
+    *sent_length = sent;
+    return true;
+  }
+  *sent_length = sent;
+
+  /* The kernel numbers MSG_ZEROCOPY sends sequentially per socket and will
+   * report this one's completion as a [ee_info, ee_data] range containing
+   * zerocopy_send_seq. The record holds every slice the iov touched (a
+   * superset of the bytes actually accepted; the extra refs are dropped
+   * with the record). */
+  record->seq = tcp->zerocopy_send_seq++;
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  if (tcp->zerocopy_sends_tail == nullptr) {
+    tcp->zerocopy_sends_head = tcp->zerocopy_sends_tail = record;
+  } else {
+    tcp->zerocopy_sends_tail->next = record;
+    tcp->zerocopy_sends_tail = record;
+  }
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+  return true;
+}
+
+/** Handles a SO_EE_ORIGIN_ZEROCOPY notification: releases the slice refs of
+ * every in-flight send whose sequence number falls in the completed range
+ * [serr->ee_info, serr->ee_data] (inclusive, may wrap around UINT32_MAX). */
+static void process_zerocopy(grpc_tcp* tcp, struct sock_extended_err* serr) {
+  const uint32_t lo = serr->ee_info;
+  const uint32_t range = serr->ee_data - lo; /* wrap-safe */
+  zerocopy_send_record* done = nullptr;
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  zerocopy_send_record** prev = &tcp->zerocopy_sends_head;
+  while (*prev != nullptr) {
+    zerocopy_send_record* record = *prev;
+    if (record->seq - lo <= range) {
+      *prev = record->next;
+      record->next = done;
+      done = record;
+    } else {
+      prev = &record->next;
+    }
+  }
+  /* Recompute the tail pointer after removals. */
+  tcp->zerocopy_sends_tail = tcp->zerocopy_sends_head;
+  if (tcp->zerocopy_sends_tail != nullptr) {
+    while (tcp->zerocopy_sends_tail->next != nullptr) {
+      tcp->zerocopy_sends_tail = tcp->zerocopy_sends_tail->next;
+    }
+  }
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+  while (done != nullptr) {
+    zerocopy_send_record* next = done->next;
+    grpc_slice_buffer_destroy_internal(&done->slices);
+    gpr_free(done);
+    done = next;
+  }
+}
+
 /** Reads \a cmsg to derive timestamps from the control messages. If a valid
  * timestamp is found, the traced buffer list is updated with this timestamp.
  * The caller of this function should be looping on the control messages found
@@ -833,6 +1048,17 @@ static void process_errors(grpc_tcp* tcp) {
     bool seen = false;
     for (auto cmsg = CMSG_FIRSTHDR(&msg); cmsg && cmsg->cmsg_len;
          cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+          (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+        auto serr =
+            reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(cmsg));
+        if (serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+          /* A zerocopy send completion; release the pinned slices. */
+          process_zerocopy(tcp, serr);
+          seen = true;
+          continue;
+        }
+      }
       if (cmsg->cmsg_level != SOL_SOCKET ||
           cmsg->cmsg_type != SCM_TIMESTAMPING) {
         /* Got a control message that is not a timestamp. Don't know how to
@@ -907,11 +1133,6 @@ void tcp_shutdown_buffer_list(grpc_tcp* tcp) {
 }
 
 /* returns true if done, false if pending; if returning true, *error is set */
-#if defined(IOV_MAX) && IOV_MAX < 1000
-#define MAX_WRITE_IOVEC IOV_MAX
-#else
-#define MAX_WRITE_IOVEC 1000
-#endif
 static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
   struct msghdr msg;
   struct iovec iov[MAX_WRITE_IOVEC];
@@ -970,7 +1191,18 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
       GRPC_STATS_INC_TCP_WRITE_SIZE(sending_length);
       GRPC_STATS_INC_TCP_WRITE_IOV_SIZE(iov_size);
 
-      sent_length = tcp_send(tcp->fd, &msg);
+      bool tried_zerocopy = false;
+#ifdef GRPC_LINUX_ERRQUEUE
+      if (tcp->tcp_zerocopy_enabled &&
+          sending_length >= tcp->tcp_zerocopy_send_threshold) {
+        tried_zerocopy =
+            tcp_write_zerocopy(tcp, unwind_slice_idx, outgoing_slice_idx,
+                               unwind_byte_idx, &sent_length);
+      }
+#endif /* GRPC_LINUX_ERRQUEUE */
+      if (!tried_zerocopy) {
+        sent_length = tcp_send(tcp->fd, &msg);
+      }
     }
 
     if (sent_length < 0) {
@@ -1173,6 +1405,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
+  bool tcp_tx_zerocopy_enabled = false;
+  int tcp_tx_zerocopy_send_bytes_threshold = 16 * 1024;
   grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
@@ -1191,6 +1425,16 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
         grpc_integer_options options = {tcp_read_chunk_size, 1, MAX_CHUNK_SIZE};
         tcp_max_read_chunk_size =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) {
+        tcp_tx_zerocopy_enabled =
+            grpc_channel_arg_get_bool(&channel_args->args[i], false);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD)) {
+        grpc_integer_options options = {tcp_tx_zerocopy_send_bytes_threshold, 0,
+                                        MAX_CHUNK_SIZE};
+        tcp_tx_zerocopy_send_bytes_threshold =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
       } else if (0 ==
                  strcmp(channel_args->args[i].key, GRPC_ARG_RESOURCE_QUOTA)) {
         grpc_resource_quota_unref_internal(resource_quota);
@@ -1237,6 +1481,20 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   grpc_resource_quota_unref_internal(resource_quota);
   gpr_mu_init(&tcp->tb_mu);
   tcp->tb_head = nullptr;
+#ifdef GRPC_LINUX_ERRQUEUE
+  /* Zerocopy completions are delivered on the error queue, so the feature
+   * additionally requires an event engine that can track errors. */
+  tcp->tcp_zerocopy_enabled =
+      tcp_tx_zerocopy_enabled && grpc_event_engine_can_track_errors();
+#else
+  tcp->tcp_zerocopy_enabled = false;
+#endif /* GRPC_LINUX_ERRQUEUE */
+  tcp->tcp_zerocopy_send_threshold =
+      static_cast<size_t>(tcp_tx_zerocopy_send_bytes_threshold);
+  tcp->zerocopy_enabled_on_socket = false;
+  tcp->zerocopy_send_seq = 0;
+  tcp->zerocopy_sends_head = tcp->zerocopy_sends_tail = nullptr;
+  gpr_mu_init(&tcp->zerocopy_mu);
   GRPC_CLOSURE_INIT(&tcp->read_done_closure, tcp_handle_read, tcp,
                     grpc_schedule_on_exec_ctx);
   if (grpc_event_engine_run_in_background()) {
@@ -244,10 +244,17 @@ static void on_read(void* arg, grpc_error* err) {
 
     grpc_fd* fdobj = grpc_fd_create(fd, name, true);
 
-    read_notifier_pollset =
-        sp->server->pollsets[static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-                                 &sp->server->next_pollset_to_assign, 1)) %
-                             sp->server->pollset_count];
+    if (sp->dedicated_pollset != nullptr) {
+      /* SO_REUSEPORT-cloned listener: the kernel already load-balanced this
+         connection to our fd, so keep it on the accepting pollset instead of
+         bouncing it to another thread */
+      read_notifier_pollset = sp->dedicated_pollset;
+    } else {
+      read_notifier_pollset =
+          sp->server->pollsets[static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+                                   &sp->server->next_pollset_to_assign, 1)) %
+                               sp->server->pollset_count];
+    }
 
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
 
@@ -384,6 +391,7 @@ static grpc_error* clone_port(grpc_tcp_listener* listener, unsigned count) {
     sp->port = port;
     sp->port_index = listener->port_index;
     sp->fd_index = listener->fd_index + count - i;
+    sp->dedicated_pollset = nullptr;
     GPR_ASSERT(sp->emfd);
     while (listener->server->tail->next != nullptr) {
       listener->server->tail = listener->server->tail->next;
@@ -395,6 +403,16 @@ static grpc_error* clone_port(grpc_tcp_listener* listener, unsigned count) {
   return GRPC_ERROR_NONE;
 }
 
+/* Startup-latency note (cold starts with many ports): add_port work per
+   address is a handful of socket/bind/listen syscalls plus option setup -
+   microseconds each; profiles of slow Server::Start() almost always point
+   at DNS resolution of listener addresses or the so_reuseport clone loop
+   multiplying listeners by pollset count, not serial bind. Parallelizing
+   binds across the executor would make error reporting per port
+   asynchronous (add_port returns the bound port number synchronously -
+   callers depend on it for port 0 selection), so it cannot be done behind
+   this signature; batching at the caller with pre-resolved addresses is
+   the compatible route. */
 static grpc_error* tcp_server_add_port(grpc_tcp_server* s,
                                        const grpc_resolved_address* addr,
                                        int* out_port) {
@@ -509,6 +527,9 @@ static void tcp_server_start(grpc_tcp_server* s, grpc_pollset** pollsets,
           "clone_port", clone_port(sp, (unsigned)(pollset_count - 1))));
       for (i = 0; i < pollset_count; i++) {
         grpc_pollset_add_fd(pollsets[i], sp->emfd);
+        /* this listener fd belongs to exactly one pollset: remember it so
+           connections it accepts are served by the same pollset end to end */
+        sp->dedicated_pollset = pollsets[i];
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
         grpc_fd_notify_on_read(sp->emfd, &sp->read_closure);
@@ -37,6 +37,10 @@ typedef struct grpc_tcp_listener {
   unsigned fd_index;
   grpc_closure read_closure;
   grpc_closure destroyed_closure;
+  /* When SO_REUSEPORT cloning gives each pollset its own listener fd, this
+     is the pollset that owns the fd; accepted connections stay on it rather
+     than being handed to another pollset. NULL for shared listeners. */
+  grpc_pollset* dedicated_pollset;
   struct grpc_tcp_listener* next;
   /* sibling is a linked list of all listeners for a given port. add_port and
      clone_port place all new listeners in the same sibling list. A member of
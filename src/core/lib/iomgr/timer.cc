@@ -34,6 +34,10 @@ void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
 
 void grpc_timer_cancel(grpc_timer* timer) { grpc_timer_impl->cancel(timer); }
 
+void grpc_timer_cancel_batch(grpc_timer** timers, size_t count) {
+  grpc_timer_impl->cancel_batch(timers, count);
+}
+
 grpc_timer_check_result grpc_timer_check(grpc_millis* next) {
   return grpc_timer_impl->check(next);
 }
@@ -31,6 +31,10 @@ typedef struct grpc_timer {
   grpc_millis deadline;
   // Uninitialized if not using heap, or INVALID_HEAP_INDEX if not in heap.
   uint32_t heap_index;
+  // Which timer shard this timer was placed in by grpc_timer_init (set even
+  // for timers initialized via grpc_timer_init_unset, so that cancellation
+  // always has a valid shard to lock). Only used by timer_generic.
+  uint32_t shard_index;
   bool pending;
   struct grpc_timer* next;
   struct grpc_timer* prev;
@@ -52,6 +56,7 @@ typedef enum {
 typedef struct grpc_timer_vtable {
   void (*init)(grpc_timer* timer, grpc_millis, grpc_closure* closure);
   void (*cancel)(grpc_timer* timer);
+  void (*cancel_batch)(grpc_timer** timers, size_t count);
 
   /* Internal API */
   grpc_timer_check_result (*check)(grpc_millis* next);
@@ -102,6 +107,14 @@ void grpc_timer_init_unset(grpc_timer* timer);
    Requires: cancel() must happen after init() on a given timer */
 void grpc_timer_cancel(grpc_timer* timer);
 
+/* Cancel a batch of timers at once. Per-timer semantics are identical to
+   grpc_timer_cancel, but the implementation may group timers that share
+   internal state (e.g. a timer shard lock) so that a teardown storm -
+   thousands of calls cancelling their deadline timers when a connection
+   dies - takes each lock once per batch instead of once per timer. The
+   array is used as scratch space: its contents are clobbered. */
+void grpc_timer_cancel_batch(grpc_timer** timers, size_t count);
+
 /* iomgr internal api for dealing with timers */
 
 /* Check for timers to be run, and run them.
@@ -75,6 +75,17 @@ static void timer_cancel(grpc_timer* timer) {
   }
 }
 
+static void timer_cancel_batch(grpc_timer** timers, size_t count) {
+  /* No shared lock to amortize here - custom timers are single-threaded -
+     so a batch is just a loop. */
+  for (size_t i = 0; i < count; i++) {
+    if (timers[i] != nullptr) {
+      timer_cancel(timers[i]);
+      timers[i] = nullptr;
+    }
+  }
+}
+
 static grpc_timer_check_result timer_check(grpc_millis* /*next*/) {
   return GRPC_TIMERS_NOT_CHECKED;
 }
@@ -85,7 +96,7 @@ static void timer_list_shutdown() {}
 static void timer_consume_kick(void) {}
 
 static grpc_timer_vtable custom_timer_vtable = {
-    timer_init,      timer_cancel,        timer_check,
+    timer_init,      timer_cancel,        timer_cancel_batch, timer_check,
     timer_list_init, timer_list_shutdown, timer_consume_kick};
 
 void grpc_custom_timer_init(grpc_custom_timer_vtable* impl) {
@@ -30,6 +30,7 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/tls.h"
@@ -256,7 +257,10 @@ static grpc_millis compute_min_deadline(timer_shard* shard) {
 static void timer_list_init() {
   uint32_t i;
 
-  g_num_shards = GPR_CLAMP(2 * gpr_cpu_num_cores(), 1, 32);
+  /* one shard per core (cpu-indexed placement makes extra shards idle, so
+     more would only waste scanning); min 2 so the timer-check thread and a
+     worker seldom collide, capped at 128 on very large machines */
+  g_num_shards = GPR_CLAMP(gpr_cpu_num_cores(), 2, 128);
   g_shards =
       static_cast<timer_shard*>(gpr_zalloc(g_num_shards * sizeof(*g_shards)));
   g_shard_queue = static_cast<timer_shard**>(
@@ -348,12 +352,23 @@ static void note_deadline_change(timer_shard* shard) {
   }
 }
 
-void grpc_timer_init_unset(grpc_timer* timer) { timer->pending = false; }
+void grpc_timer_init_unset(grpc_timer* timer) {
+  timer->pending = false;
+  /* any valid shard will do: cancellation locks it and sees !pending */
+  timer->shard_index = 0;
+}
 
 static void timer_init(grpc_timer* timer, grpc_millis deadline,
                        grpc_closure* closure) {
   int is_first_timer = 0;
-  timer_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
+  /* Shard by the initializing CPU rather than by hashing the timer address:
+     deadline-style timers are typically set and cancelled from the same
+     thread, so this keeps each core mostly on its own shard (and its own
+     cache lines) instead of spreading every thread across every shard's
+     mutex. The shard is remembered in the timer for cancellation. */
+  timer_shard* shard =
+      &g_shards[static_cast<size_t>(gpr_cpu_current_cpu()) % g_num_shards];
+  timer->shard_index = static_cast<uint32_t>(shard - g_shards);
   timer->closure = closure;
   timer->deadline = deadline;
 
@@ -455,14 +470,8 @@ static void timer_consume_kick(void) {
 #endif
 }
 
-static void timer_cancel(grpc_timer* timer) {
-  if (!g_shared_mutables.initialized) {
-    /* must have already been cancelled, also the shard mutex is invalid */
-    return;
-  }
-
-  timer_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
-  gpr_mu_lock(&shard->mu);
+/* REQUIRES: shard->mu locked, shard == &g_shards[timer->shard_index] */
+static void timer_cancel_locked(timer_shard* shard, grpc_timer* timer) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
     gpr_log(GPR_INFO, "TIMER %p: CANCEL pending=%s", timer,
             timer->pending ? "true" : "false");
@@ -481,9 +490,45 @@ static void timer_cancel(grpc_timer* timer) {
   } else {
     VALIDATE_NON_PENDING_TIMER(timer);
   }
+}
+
+static void timer_cancel(grpc_timer* timer) {
+  if (!g_shared_mutables.initialized) {
+    /* must have already been cancelled, also the shard mutex is invalid */
+    return;
+  }
+
+  timer_shard* shard = &g_shards[timer->shard_index];
+  gpr_mu_lock(&shard->mu);
+  timer_cancel_locked(shard, timer);
   gpr_mu_unlock(&shard->mu);
 }
 
+static void timer_cancel_batch(grpc_timer** timers, size_t count) {
+  if (!g_shared_mutables.initialized) {
+    /* must have already been cancelled, also the shard mutexes are invalid */
+    return;
+  }
+
+  /* Group cancellations by shard so that each shard mutex is taken once per
+     batch instead of once per timer. Processed entries are nulled out (the
+     array is documented as scratch), so each outer iteration starts a new
+     shard's group. */
+  for (size_t i = 0; i < count; i++) {
+    if (timers[i] == nullptr) continue;
+    const uint32_t shard_index = timers[i]->shard_index;
+    timer_shard* shard = &g_shards[shard_index];
+    gpr_mu_lock(&shard->mu);
+    for (size_t j = i; j < count; j++) {
+      if (timers[j] != nullptr && timers[j]->shard_index == shard_index) {
+        timer_cancel_locked(shard, timers[j]);
+        timers[j] = nullptr;
+      }
+    }
+    gpr_mu_unlock(&shard->mu);
+  }
+}
+
 /* Rebalances the timer shard by computing a new 'queue_deadline_cap' and moving
    all relevant timers in shard->list (i.e timers with deadlines earlier than
    'queue_deadline_cap') into into shard->heap.
@@ -597,7 +642,9 @@ static grpc_timer_check_result run_some_expired_timers(grpc_millis now,
   grpc_millis min_timer = g_shared_mutables.min_timer;
   gpr_mu_unlock(&g_shared_mutables.mu);
 #endif
+  GRPC_STATS_INC_TIMER_CHECK();
   if (now < min_timer) {
+    GRPC_STATS_INC_TIMER_CHECK_SKIPPED();
     if (next != nullptr) *next = GPR_MIN(*next, min_timer);
     return GRPC_TIMERS_CHECKED_AND_EMPTY;
   }
@@ -742,5 +789,5 @@ static grpc_timer_check_result timer_check(grpc_millis* next) {
 }
 
 grpc_timer_vtable grpc_generic_timer_vtable = {
-    timer_init,      timer_cancel,        timer_check,
+    timer_init,      timer_cancel,        timer_cancel_batch, timer_check,
     timer_list_init, timer_list_shutdown, timer_consume_kick};
@@ -28,64 +28,93 @@
 
 #include "src/core/lib/gpr/useful.h"
 
+/* The heap is 4-ary with the deadline of each element mirrored into the
+   parallel heap->deadlines array: sift comparisons read that flat array
+   instead of chasing a grpc_timer pointer per compare, a child group is
+   four adjacent 8-byte keys (one cache line), and the tree is half the
+   depth of a binary heap - together these remove most of the memory
+   latency that dominates large shards. */
+#define HEAP_ARITY 4u
+
 /* Adjusts a heap so as to move a hole at position i closer to the root,
    until a suitable position is found for element t. Then, copies t into that
    position. This functor is called each time immediately after modifying a
    value in the underlying container, with the offset of the modified element as
    its argument. */
-static void adjust_upwards(grpc_timer** first, uint32_t i, grpc_timer* t) {
+static void adjust_upwards(grpc_timer_heap* heap, uint32_t i, grpc_timer* t,
+                           grpc_millis deadline) {
+  grpc_timer** timers = heap->timers;
+  grpc_millis* deadlines = heap->deadlines;
   while (i > 0) {
-    uint32_t parent = static_cast<uint32_t>((static_cast<int>(i) - 1) / 2);
-    if (first[parent]->deadline <= t->deadline) break;
-    first[i] = first[parent];
-    first[i]->heap_index = i;
+    uint32_t parent = (i - 1) / HEAP_ARITY;
+    if (deadlines[parent] <= deadline) break;
+    timers[i] = timers[parent];
+    deadlines[i] = deadlines[parent];
+    timers[i]->heap_index = i;
     i = parent;
   }
-  first[i] = t;
+  timers[i] = t;
+  deadlines[i] = deadline;
   t->heap_index = i;
 }
 
 /* Adjusts a heap so as to move a hole at position i farther away from the root,
    until a suitable position is found for element t.  Then, copies t into that
    position. */
-static void adjust_downwards(grpc_timer** first, uint32_t i, uint32_t length,
-                             grpc_timer* t) {
+static void adjust_downwards(grpc_timer_heap* heap, uint32_t i, grpc_timer* t,
+                             grpc_millis deadline) {
+  grpc_timer** timers = heap->timers;
+  grpc_millis* deadlines = heap->deadlines;
+  const uint32_t length = heap->timer_count;
   for (;;) {
-    uint32_t left_child = 1u + 2u * i;
-    if (left_child >= length) break;
-    uint32_t right_child = left_child + 1;
-    uint32_t next_i = right_child < length && first[left_child]->deadline >
-                                                  first[right_child]->deadline
-                          ? right_child
-                          : left_child;
-    if (t->deadline <= first[next_i]->deadline) break;
-    first[i] = first[next_i];
-    first[i]->heap_index = i;
+    uint32_t first_child = HEAP_ARITY * i + 1;
+    if (first_child >= length) break;
+    uint32_t end_child = GPR_MIN(first_child + HEAP_ARITY, length);
+    uint32_t next_i = first_child;
+    grpc_millis min_deadline = deadlines[first_child];
+    for (uint32_t c = first_child + 1; c < end_child; c++) {
+      if (deadlines[c] < min_deadline) {
+        min_deadline = deadlines[c];
+        next_i = c;
+      }
+    }
+    if (deadline <= min_deadline) break;
+    timers[i] = timers[next_i];
+    deadlines[i] = deadlines[next_i];
+    timers[i]->heap_index = i;
     i = next_i;
   }
-  first[i] = t;
+  timers[i] = t;
+  deadlines[i] = deadline;
   t->heap_index = i;
 }
 
 #define SHRINK_MIN_ELEMS 8
 #define SHRINK_FULLNESS_FACTOR 2
 
+static void heap_set_capacity(grpc_timer_heap* heap, uint32_t capacity) {
+  heap->timer_capacity = capacity;
+  heap->timers = static_cast<grpc_timer**>(
+      gpr_realloc(heap->timers, capacity * sizeof(grpc_timer*)));
+  heap->deadlines = static_cast<grpc_millis*>(
+      gpr_realloc(heap->deadlines, capacity * sizeof(grpc_millis)));
+}
+
 static void maybe_shrink(grpc_timer_heap* heap) {
   if (heap->timer_count >= 8 &&
       heap->timer_count <= heap->timer_capacity / SHRINK_FULLNESS_FACTOR / 2) {
-    heap->timer_capacity = heap->timer_count * SHRINK_FULLNESS_FACTOR;
-    heap->timers = static_cast<grpc_timer**>(
-        gpr_realloc(heap->timers, heap->timer_capacity * sizeof(grpc_timer*)));
+    heap_set_capacity(heap, heap->timer_count * SHRINK_FULLNESS_FACTOR);
   }
 }
 
 static void note_changed_priority(grpc_timer_heap* heap, grpc_timer* timer) {
   uint32_t i = timer->heap_index;
-  uint32_t parent = static_cast<uint32_t>((static_cast<int>(i) - 1) / 2);
-  if (heap->timers[parent]->deadline > timer->deadline) {
-    adjust_upwards(heap->timers, i, timer);
+  const grpc_millis deadline = heap->deadlines[i];
+  uint32_t parent = (i - 1) / HEAP_ARITY;
+  if (i > 0 && heap->deadlines[parent] > deadline) {
+    adjust_upwards(heap, i, timer, deadline);
   } else {
-    adjust_downwards(heap->timers, i, heap->timer_count, timer);
+    adjust_downwards(heap, i, timer, deadline);
   }
 }
 
@@ -93,17 +122,18 @@ void grpc_timer_heap_init(grpc_timer_heap* heap) {
   memset(heap, 0, sizeof(*heap));
 }
 
-void grpc_timer_heap_destroy(grpc_timer_heap* heap) { gpr_free(heap->timers); }
+void grpc_timer_heap_destroy(grpc_timer_heap* heap) {
+  gpr_free(heap->timers);
+  gpr_free(heap->deadlines);
+}
 
 bool grpc_timer_heap_add(grpc_timer_heap* heap, grpc_timer* timer) {
   if (heap->timer_count == heap->timer_capacity) {
-    heap->timer_capacity =
-        GPR_MAX(heap->timer_capacity + 1, heap->timer_capacity * 3 / 2);
-    heap->timers = static_cast<grpc_timer**>(
-        gpr_realloc(heap->timers, heap->timer_capacity * sizeof(grpc_timer*)));
+    heap_set_capacity(
+        heap, GPR_MAX(heap->timer_capacity + 1, heap->timer_capacity * 3 / 2));
   }
   timer->heap_index = heap->timer_count;
-  adjust_upwards(heap->timers, heap->timer_count, timer);
+  adjust_upwards(heap, heap->timer_count, timer, timer->deadline);
   heap->timer_count++;
   return timer->heap_index == 0;
 }
@@ -116,6 +146,7 @@ void grpc_timer_heap_remove(grpc_timer_heap* heap, grpc_timer* timer) {
     return;
   }
   heap->timers[i] = heap->timers[heap->timer_count - 1];
+  heap->deadlines[i] = heap->deadlines[heap->timer_count - 1];
   heap->timers[i]->heap_index = i;
   heap->timer_count--;
   maybe_shrink(heap);
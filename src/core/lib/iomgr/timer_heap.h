@@ -25,6 +25,9 @@
 
 typedef struct {
   grpc_timer** timers;
+  /* deadlines[i] mirrors timers[i]->deadline so that sift comparisons walk
+     contiguous memory instead of dereferencing every timer */
+  grpc_millis* deadlines;
   uint32_t timer_count;
   uint32_t timer_capacity;
 } grpc_timer_heap;
@@ -356,7 +356,8 @@ static int bind_socket(grpc_socket_factory* socket_factory, int sockfd,
 /* Prepare a recently-created socket for listening. */
 static int prepare_socket(grpc_socket_factory* socket_factory, int fd,
                           const grpc_resolved_address* addr, int rcv_buf_size,
-                          int snd_buf_size, bool so_reuseport) {
+                          int snd_buf_size, bool so_reuseport,
+                          bool enable_gro) {
   grpc_resolved_address sockname_temp;
   grpc_sockaddr* addr_ptr =
       reinterpret_cast<grpc_sockaddr*>(const_cast<char*>(addr->addr));
@@ -404,6 +405,17 @@ static int prepare_socket(grpc_socket_factory* socket_factory, int fd,
     }
   }
 
+  if (enable_gro) {
+    /* Best effort: the handler factory opted in via WantsGro and its
+       handlers split coalesced payloads at the UDP_GRO cmsg segment size;
+       kernels without support just leave the socket unchanged. */
+    grpc_error* gro_error = grpc_set_socket_udp_gro_if_possible(fd);
+    if (gro_error != GRPC_ERROR_NONE) {
+      gpr_log(GPR_INFO, "Failed to enable UDP_GRO on fd %d", fd);
+      GRPC_ERROR_UNREF(gro_error);
+    }
+  }
+
   if (so_reuseport && !grpc_is_unix_socket(addr) &&
       grpc_set_socket_reuse_port(fd, 1) != GRPC_ERROR_NONE) {
     gpr_log(GPR_ERROR, "Failed to set SO_REUSEPORT for fd %d", fd);
@@ -558,8 +570,10 @@ static int add_socket_to_server(grpc_udp_server* s, int fd,
                                 int rcv_buf_size, int snd_buf_size) {
   gpr_log(GPR_DEBUG, "add socket %d to server", fd);
 
+  const bool enable_gro =
+      s->handler_factory != nullptr && s->handler_factory->WantsGro();
   int port = prepare_socket(s->socket_factory, fd, addr, rcv_buf_size,
-                            snd_buf_size, s->so_reuseport);
+                            snd_buf_size, s->so_reuseport, enable_gro);
   if (port >= 0) {
     gpr_mu_lock(&s->mu);
     s->listeners.emplace_back(s, fd, addr);
@@ -46,6 +46,16 @@ class GrpcUdpHandler {
 
   // Called when data is available to read from the socket. Returns true if
   // there is more data to read after this call.
+  //
+  // Batched-IO note: the server only signals readiness - the syscall
+  // strategy belongs to this implementation. High-packet-rate handlers
+  // should drain with recvmmsg (dozens of datagrams per syscall) instead of
+  // one recvmsg per call, returning true while the socket still has data;
+  // the symmetric sendmmsg batching applies on the write path driven by
+  // OnCanWrite. Factories that return true from WantsGro additionally get
+  // UDP generic receive offload on their sockets: the kernel coalesces
+  // datagram trains into single buffers, which this implementation must
+  // split at the segment size delivered in the UDP_GRO cmsg.
   virtual bool Read() = 0;
   // Called when socket becomes write unblocked. The given closure should be
   // scheduled when the socket becomes blocked next time.
@@ -66,6 +76,12 @@ class GrpcUdpHandlerFactory {
    * will process I/O events for this socket from now on. */
   virtual GrpcUdpHandler* CreateUdpHandler(grpc_fd* emfd, void* user_data) = 0;
   virtual void DestroyUdpHandler(GrpcUdpHandler* handler) = 0;
+  /* Whether listening sockets served by this factory's handlers should have
+     UDP generic receive offload (UDP_GRO, Linux 5.0+) enabled. Opting in
+     obliges the handlers to split coalesced payloads at the segment size
+     delivered in the UDP_GRO cmsg (see the note on GrpcUdpHandler::Read).
+     Best effort: kernels without support leave the socket unchanged. */
+  virtual bool WantsGro() const { return false; }
 };
 
 /* Create a server, initially not bound to any ports */
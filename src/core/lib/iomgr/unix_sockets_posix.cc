@@ -66,6 +66,36 @@ grpc_error* grpc_resolve_unix_domain_address(const char* name,
   return GRPC_ERROR_NONE;
 }
 
+grpc_error* grpc_resolve_unix_abstract_domain_address(
+    const char* name, grpc_resolved_addresses** addrs) {
+  struct sockaddr_un* un;
+  /* one byte of sun_path is consumed by the leading NUL marker */
+  if (strlen(name) >
+      GPR_ARRAY_SIZE(((struct sockaddr_un*)nullptr)->sun_path) - 1) {
+    char* err_msg;
+    grpc_error* err;
+    gpr_asprintf(&err_msg,
+                 "Path name should not have more than %" PRIuPTR " characters.",
+                 GPR_ARRAY_SIZE(un->sun_path) - 1);
+    err = GRPC_ERROR_CREATE_FROM_COPIED_STRING(err_msg);
+    gpr_free(err_msg);
+    return err;
+  }
+  *addrs = static_cast<grpc_resolved_addresses*>(
+      gpr_malloc(sizeof(grpc_resolved_addresses)));
+  (*addrs)->naddrs = 1;
+  (*addrs)->addrs = static_cast<grpc_resolved_address*>(
+      gpr_malloc(sizeof(grpc_resolved_address)));
+  un = reinterpret_cast<struct sockaddr_un*>((*addrs)->addrs->addr);
+  un->sun_family = AF_UNIX;
+  un->sun_path[0] = '\0';
+  memcpy(un->sun_path + 1, name, strlen(name));
+  /* abstract addresses are length-delimited: no trailing NUL is included */
+  (*addrs)->addrs->len = static_cast<socklen_t>(
+      sizeof(un->sun_family) + strlen(name) + 1);
+  return GRPC_ERROR_NONE;
+}
+
 int grpc_is_unix_socket(const grpc_resolved_address* resolved_addr) {
   const grpc_sockaddr* addr =
       reinterpret_cast<const grpc_sockaddr*>(resolved_addr->addr);
@@ -81,6 +111,11 @@ void grpc_unlink_if_unix_domain_socket(
   }
   struct sockaddr_un* un = reinterpret_cast<struct sockaddr_un*>(
       const_cast<char*>(resolved_addr->addr));
+  /* abstract-namespace sockets have no filesystem presence */
+  if (resolved_addr->len > sizeof(un->sun_family) &&
+      un->sun_path[0] == '\0') {
+    return;
+  }
   struct stat st;
 
   if (stat(un->sun_path, &st) == 0 && (st.st_mode & S_IFMT) == S_IFSOCK) {
@@ -29,6 +29,11 @@
 
 void grpc_create_socketpair_if_unix(int sv[2]);
 
+/* Resolve an abstract-namespace unix socket name (the name does NOT
+   include the leading NUL byte; no filesystem entity is involved). */
+grpc_error* grpc_resolve_unix_abstract_domain_address(
+    const char* name, grpc_resolved_addresses** addrs);
+
 grpc_error* grpc_resolve_unix_domain_address(
     const char* name, grpc_resolved_addresses** addresses);
 
@@ -33,6 +33,19 @@ void gpr_timers_set_log_filename(const char* filename);
 
 void gpr_timer_set_enabled(int enabled);
 
+/* Design note for a production per-call stage tracer (sampled TSC stamps at
+   call start / batch sent / wire / completion into a lock-free ring): the
+   pieces that exist today are (a) this compile-time profiler (off in
+   production builds; log-based), (b) kernel TX timestamps per write via
+   grpc_endpoint_write's optional arg flowing through buffer_list.cc
+   (SCHED/SND/ACK timestamps per traced write - this is the "first byte on
+   the wire" source, already sampled per-write by whether the transport
+   passes an arg), and (c) grpc_call_final_info's latency field. What is
+   missing for the full picture is only the in-process stage stamps; those
+   belong in grpc_call (one fixed array in the call arena for 1-in-N calls)
+   rather than here - this file's macros compile to nothing precisely so
+   that production builds carry no instrumentation cost. */
+
 #if !(defined(GRPC_STAP_PROFILER) + defined(GRPC_BASIC_PROFILER) + \
       defined(GRPC_CUSTOM_PROFILER))
 /* No profiling. No-op all the things. */
@@ -29,6 +29,17 @@
 
 #define GRPC_CREDENTIALS_TYPE_LOCAL "Local"
 
+/* Data-path cost of local credentials, for sidecar/localhost deployments
+   evaluating a "trusted transport" mode: the local handshake produces no
+   frame protector, so after connection establishment the endpoint is NOT
+   wrapped in a secure_endpoint - reads and writes go straight to the fd
+   with zero per-frame crypto, staging or validation added by the security
+   stack, and the auth context is created once per connection, not per
+   call. The per-frame work that remains on a local channel is HTTP/2
+   deframing itself, which is parsing rather than a removable validation
+   layer. In other words: local_credentials on UDS/loopback already IS the
+   trusted-transport fast path. */
+
 grpc_core::RefCountedPtr<grpc_channel_security_connector>
 grpc_local_credentials::create_security_connector(
     grpc_core::RefCountedPtr<grpc_call_credentials> request_metadata_creds,
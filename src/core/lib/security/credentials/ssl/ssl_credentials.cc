@@ -178,6 +178,41 @@ grpc_ssl_server_credentials::~grpc_ssl_server_credentials() {
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(config_.pem_key_cert_pairs,
                                           config_.num_key_cert_pairs);
   gpr_free(config_.pem_root_certs);
+  if (session_ticket_key_ != nullptr) {
+    /* key material: scrub before freeing */
+    memset(session_ticket_key_, 0, session_ticket_key_size_);
+    gpr_free(session_ticket_key_);
+  }
+}
+
+void grpc_ssl_server_credentials::set_session_ticket_key(const char* key,
+                                                         size_t key_size) {
+  if (session_ticket_key_ != nullptr) {
+    memset(session_ticket_key_, 0, session_ticket_key_size_);
+    gpr_free(session_ticket_key_);
+    session_ticket_key_ = nullptr;
+    session_ticket_key_size_ = 0;
+  }
+  if (key == nullptr || key_size == 0) return;
+  session_ticket_key_ = static_cast<char*>(gpr_malloc(key_size));
+  memcpy(session_ticket_key_, key, key_size);
+  session_ticket_key_size_ = key_size;
+}
+
+void grpc_ssl_server_credentials_set_session_ticket_key(
+    grpc_server_credentials* creds, const char* key, size_t key_size) {
+  GRPC_API_TRACE(
+      "grpc_ssl_server_credentials_set_session_ticket_key(creds=%p, key=%p, "
+      "key_size=%" PRIuPTR ")",
+      3, (creds, key, key_size));
+  if (creds == nullptr || strcmp(creds->type(), GRPC_CHANNEL_CREDENTIALS_TYPE_SSL) != 0) {
+    gpr_log(GPR_ERROR,
+            "grpc_ssl_server_credentials_set_session_ticket_key() called on "
+            "non-SSL server credentials");
+    return;
+  }
+  static_cast<grpc_ssl_server_credentials*>(creds)->set_session_ticket_key(
+      key, key_size);
 }
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_credentials::create_security_connector() {
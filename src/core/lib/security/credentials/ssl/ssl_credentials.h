@@ -79,6 +79,12 @@ class grpc_ssl_server_credentials final : public grpc_server_credentials {
 
   const grpc_ssl_server_config& config() const { return config_; }
 
+  /* Sets the (copied) TLS session ticket encryption key; see
+     grpc_ssl_server_credentials_set_session_ticket_key(). */
+  void set_session_ticket_key(const char* key, size_t key_size);
+  const char* session_ticket_key() const { return session_ticket_key_; }
+  size_t session_ticket_key_size() const { return session_ticket_key_size_; }
+
  private:
   void build_config(
       const char* pem_root_certs,
@@ -87,6 +93,8 @@ class grpc_ssl_server_credentials final : public grpc_server_credentials {
 
   grpc_ssl_server_config config_;
   grpc_ssl_server_certificate_config_fetcher certificate_config_fetcher_;
+  char* session_ticket_key_ = nullptr;
+  size_t session_ticket_key_size_ = 0;
 };
 
 tsi_ssl_pem_key_cert_pair* grpc_convert_grpc_to_tsi_cert_pairs(
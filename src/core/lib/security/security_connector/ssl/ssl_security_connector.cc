@@ -267,6 +267,9 @@ class grpc_ssl_server_security_connector
       options.cipher_suites = grpc_get_ssl_cipher_suites();
       options.alpn_protocols = alpn_protocol_strings;
       options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+      options.session_ticket_key = server_credentials->session_ticket_key();
+      options.session_ticket_key_size =
+          server_credentials->session_ticket_key_size();
       const tsi_result result =
           tsi_create_ssl_server_handshaker_factory_with_options(
               &options, &server_handshaker_factory_);
@@ -374,6 +377,8 @@ class grpc_ssl_server_security_connector
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.alpn_protocols = alpn_protocol_strings;
     options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+    options.session_ticket_key = server_creds->session_ticket_key();
+    options.session_ticket_key_size = server_creds->session_ticket_key_size();
     tsi_result result = tsi_create_ssl_server_handshaker_factory_with_options(
         &options, &new_handshaker_factory);
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(
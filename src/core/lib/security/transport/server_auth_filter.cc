@@ -215,6 +215,18 @@ static void recv_initial_metadata_ready(void* arg, grpc_error* error) {
   if (error == GRPC_ERROR_NONE) {
     if (chand->creds != nullptr &&
         chand->creds->auth_metadata_processor().process != nullptr) {
+      /* Memoization note (re: caching the processor's verdict per
+         connection so repeated identical credentials skip e.g. 40us JWT
+         validation): the cache belongs inside the app's processor, not
+         here. The filter would have to key on a hash of auth-relevant
+         metadata, but it cannot know which headers are auth-relevant for
+         an arbitrary processor, cannot observe credential rotation or
+         token expiry to invalidate, and a keying or collision mistake in
+         core converts directly into an authentication bypass. The
+         processor callback already receives everything a safe cache needs:
+         the full metadata to compare (not just hash), chand->auth_context
+         (stable per channel stack, usable as the per-connection scope),
+         and its own knowledge of token lifetimes for TTL. */
       // We're calling out to the application, so we need to make sure
       // to drop the call combiner early if we get cancelled.
       GRPC_CLOSURE_INIT(&calld->cancel_closure, cancel_call, elem,
@@ -237,3 +237,14 @@ fail:
   grpc_slice_unref_internal(result);
   return grpc_empty_slice();
 }
+
+/* SIMD (SSSE3/AVX2 lookup-shuffle) variants of these loops are a known
+   ~10x win on multi-hundred-byte inputs, but this tree deliberately
+   carries no runtime CPU dispatch infrastructure (no cpuid probing, no
+   per-ISA object files in the build), and hand-vectorized crypto-adjacent
+   code without that scaffolding is a portability and review burden out of
+   proportion to the cycles: -bin metadata values are typically tens of
+   bytes, and the ~1KB JWT decode happens once per token validation, not
+   per call (verified tokens are cached by the auth layer). If a dispatch
+   framework ever lands for another consumer, base64 is a good second
+   tenant; do not build the framework for base64 alone. */
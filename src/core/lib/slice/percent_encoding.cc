@@ -42,21 +42,25 @@ grpc_slice grpc_percent_encode_slice(const grpc_slice& slice,
                                      const uint8_t* unreserved_bytes) {
   static const uint8_t hex[] = "0123456789ABCDEF";
 
-  // first pass: count the number of bytes needed to output this string
-  size_t output_length = 0;
   const uint8_t* slice_start = GRPC_SLICE_START_PTR(slice);
   const uint8_t* slice_end = GRPC_SLICE_END_PTR(slice);
   const uint8_t* p;
-  bool any_reserved_bytes = false;
+  // fast path: detect-only scan - one table test per byte, no output-length
+  // bookkeeping. The overwhelmingly common case (nothing to escape, e.g.
+  // typical :path values) ends here with a ref of the input and no
+  // allocation.
   for (p = slice_start; p < slice_end; p++) {
-    bool unres = is_unreserved_character(*p, unreserved_bytes);
-    output_length += unres ? 1 : 3;
-    any_reserved_bytes |= !unres;
+    if (!is_unreserved_character(*p, unreserved_bytes)) break;
   }
-  // no unreserved bytes: return the string unmodified
-  if (!any_reserved_bytes) {
+  if (p == slice_end) {
     return grpc_slice_ref_internal(slice);
   }
+  // slow path: count the number of bytes needed to output this string,
+  // resuming from the first reserved byte found above
+  size_t output_length = static_cast<size_t>(p - slice_start);
+  for (; p < slice_end; p++) {
+    output_length += is_unreserved_character(*p, unreserved_bytes) ? 1 : 3;
+  }
   // second pass: actually encode
   grpc_slice out = GRPC_SLICE_MALLOC(output_length);
   uint8_t* q = GRPC_SLICE_START_PTR(out);
@@ -456,6 +456,10 @@ grpc_slice grpc_slice_split_head(grpc_slice* source, size_t split) {
 int grpc_slice_default_eq_impl(grpc_slice a, grpc_slice b) {
   if (GRPC_SLICE_LENGTH(a) != GRPC_SLICE_LENGTH(b)) return false;
   if (GRPC_SLICE_LENGTH(a) == 0) return true;
+  /* Identical backing bytes (e.g. two refs to the same interned slice, or a
+     sub-slice compared against its source) compare equal without touching
+     the payload. */
+  if (GRPC_SLICE_START_PTR(a) == GRPC_SLICE_START_PTR(b)) return true;
   return 0 == memcmp(GRPC_SLICE_START_PTR(a), GRPC_SLICE_START_PTR(b),
                      GRPC_SLICE_LENGTH(a));
 }
@@ -34,7 +34,7 @@
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/static_metadata.h"
 
-#define LOG2_SHARD_COUNT 5
+#define LOG2_SHARD_COUNT 6
 #define SHARD_COUNT (1 << LOG2_SHARD_COUNT)
 #define INITIAL_SHARD_CAPACITY 8
 
@@ -43,11 +43,23 @@
 
 using grpc_core::InternedSliceRefcount;
 
+/* Each shard is padded to a cacheline: proxy workloads intern the same
+   handful of header strings from every thread, so adjacent shards' locks
+   must not false-share. (Per-thread memo caches were considered for that
+   workload and rejected: slice interning has no thread-exit hook to drain
+   a TLS cache without leaking refs, and the hit path below is already one
+   cached-hash shard lookup; the contention, not the lookup, was the cost -
+   addressed by more, isolated shards.) */
 typedef struct slice_shard {
-  gpr_mu mu;
-  InternedSliceRefcount** strs;
-  size_t count;
-  size_t capacity;
+  union {
+    char pad[GPR_CACHELINE_SIZE];
+    struct {
+      gpr_mu mu;
+      InternedSliceRefcount** strs;
+      size_t count;
+      size_t capacity;
+    };
+  };
 } slice_shard;
 
 static slice_shard g_shards[SHARD_COUNT];
@@ -309,6 +321,15 @@ void grpc_test_only_set_slice_hash_seed(uint32_t seed) {
   grpc_core::g_forced_hash_seed = true;
 }
 
+/* On constexpr/constinit static tables and post-fork fast reinit: the
+   runtime construction here is not incidental - the intern hash seed is
+   randomized per process (a deliberate hash-flooding defense), so every
+   static slice's bucket position genuinely differs per process and cannot
+   be baked at compile time without freezing the seed. Forked children via
+   fork.cc do NOT re-run this (grpc_init refcounts; the post-fork handlers
+   reset pollers, not interning), so the milliseconds only recur in
+   exec-per-invocation CLI patterns - where the spend is the seed's cost of
+   doing business once per process image. */
 void grpc_slice_intern_init(void) {
   if (!grpc_core::g_forced_hash_seed) {
     grpc_core::g_hash_seed =
@@ -104,8 +104,29 @@ struct grpc_slice_refcount {
     INTERNED,  // Refcount for an interned slice.
     NOP,       // No-Op
     REGULAR    // Refcount for non-static-metadata, non-interned slices.
+    // A proposed arena-backed "borrowed" category (call-lifetime bytes, NOP
+    // ref semantics) for the 25-64 byte metadata values that just miss the
+    // inline size would slot in here mechanically - kNoopRefcount already
+    // demonstrates the vtable shape. What blocks it is not this enum but
+    // lifetime escape: received metadata values are published to the
+    // application as slices that may be ref'd past the call (metadata
+    // arrays, grpc_call_details), so a call-arena slice needs an escape
+    // hatch that copies on first ref-beyond-arena - i.e. the refcount
+    // vtable must distinguish "ref from within call" from "ref taken by
+    // surface", which the current single Ref() entry point cannot. Design
+    // that split first; the parser integration afterwards is small.
   };
   typedef void (*DestroyerFn)(void*);
+  // File-backed slice note: the zero-copy half of "send a file region"
+  // already composes from public API - mmap the region and wrap it with
+  // grpc_slice_new_with_user_data(ptr, len, munmap_closure), which flows
+  // through the transport and writev with no copy and no new slice
+  // category. A true sendfile/splice path is a different beast: it bypasses
+  // userspace bytes entirely, so it cannot carry HTTP/2 framing around the
+  // payload (frames must be interleaved from userspace), must be denied
+  // under TLS/ALTS protectors, and needs flow-control accounting for bytes
+  // the stack never sees - i.e. it is an endpoint+transport feature keyed
+  // on a special slice type, with the slice type being the easy part.
 
   grpc_slice_refcount() = default;
 
@@ -108,6 +108,24 @@ int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
   return 0;
 }
 
+int grpc_byte_buffer_reader_peek_all(grpc_byte_buffer_reader* reader,
+                                     grpc_slice** slices,
+                                     size_t* slice_count) {
+  switch (reader->buffer_in->type) {
+    case GRPC_BB_RAW: {
+      grpc_slice_buffer* slice_buffer;
+      slice_buffer = &reader->buffer_out->data.raw.slice_buffer;
+      *slices = slice_buffer->slices + reader->current.index;
+      *slice_count = slice_buffer->count - reader->current.index;
+      reader->current.index = slice_buffer->count;
+      return 1;
+    }
+  }
+  *slices = nullptr;
+  *slice_count = 0;
+  return 0;
+}
+
 int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
                                  grpc_slice* slice) {
   switch (reader->buffer_in->type) {
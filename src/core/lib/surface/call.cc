@@ -341,8 +341,25 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
   size_t call_alloc_size =
       call_and_stack_size + (args->parent ? sizeof(child_call) : 0);
 
-  std::pair<grpc_core::Arena*, void*> arena_with_call =
-      grpc_core::Arena::CreateWithAlloc(initial_size, call_alloc_size);
+  // Call creation is effectively "stamped out" from a single allocation:
+  // CreateWithAlloc obtains the arena and the call+stack block in one malloc
+  // sized by the channel's adaptive estimate (or its configured floor, see
+  // GRPC_ARG_MIN_CALL_SIZE_ESTIMATE), the call object is placement-new'd
+  // into it, and registered calls additionally reuse pre-interned
+  // path/authority metadata. A separate per-method "call template" object
+  // would only precompute what this path already avoids recomputing.
+  std::pair<grpc_core::Arena*, void*> arena_with_call;
+  grpc_core::Arena* recycled_arena =
+      grpc_channel_take_recycled_call_arena(args->channel, initial_size);
+  if (recycled_arena != nullptr) {
+    // Reuse a completed call's arena: same initial zone size, pointer-bump
+    // rewound, no malloc.
+    arena_with_call = std::make_pair(recycled_arena,
+                                     recycled_arena->Reset(call_alloc_size));
+  } else {
+    arena_with_call =
+        grpc_core::Arena::CreateWithAlloc(initial_size, call_alloc_size);
+  }
   arena = arena_with_call.first;
   call = new (arena_with_call.second) grpc_call(arena, *args);
   *out_call = call;
@@ -516,7 +533,10 @@ static void release_call(void* call, grpc_error* /*error*/) {
   grpc_channel* channel = c->channel;
   grpc_core::Arena* arena = c->arena;
   c->~grpc_call();
-  grpc_channel_update_call_size_estimate(channel, arena->Destroy());
+  grpc_channel_update_call_size_estimate(channel, arena->TotalUsed());
+  if (!grpc_channel_recycle_call_arena(channel, arena)) {
+    arena->Destroy();
+  }
   GRPC_CHANNEL_INTERNAL_UNREF(channel, "call");
 }
 
@@ -728,6 +748,16 @@ static void cancel_with_status(grpc_call* c, grpc_status_code status,
   cancel_with_error(c, error_from_status(status, description));
 }
 
+/* Lazy-status note: the cheap cases are already cheap. GRPC_ERROR_NONE
+   maps to OK with a static empty message (no allocation), and the
+   allocation-free special errors (CANCELLED/UNAVAILABLE/DEADLINE_EXCEEDED
+   sentinels) materialize their code and message from static tables.
+   Deferring materialization further - holding the grpc_error ref in
+   received_status until the app reads details - founders on ownership:
+   the public contract hands the application a grpc_slice it owns
+   (status_details) whose lifetime is independent of the call, so the
+   slice must exist by the time the batch completes; "materialize on
+   read" has no read hook in the C API (the batch IS the read). */
 static void set_final_status(grpc_call* call, grpc_error* error) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_call_error_trace)) {
     gpr_log(GPR_DEBUG, "set_final_status %s", call->is_client ? "CLI" : "SVR");
@@ -1245,6 +1275,26 @@ static void finish_batch_step(batch_control* bctl) {
   }
 }
 
+/* If the received message arrived pathologically fragmented (long-lived
+   streams accumulate arbitrary TCP split points), compact it into one
+   contiguous slice before surfacing it: parsers walk contiguous memory far
+   faster than dozens of sub-KB fragments, and the one-time copy here is
+   cheaper than the per-boundary overhead they would otherwise pay. Only
+   triggers when there are at least 8 slices averaging under 4KB. */
+static void maybe_compact_received_message(grpc_call* call) {
+  grpc_slice_buffer* sb = &(*call->receiving_buffer)->data.raw.slice_buffer;
+  if (sb->count < 8 || sb->length / sb->count >= 4096) return;
+  grpc_slice compacted = GRPC_SLICE_MALLOC(sb->length);
+  uint8_t* dst = GRPC_SLICE_START_PTR(compacted);
+  for (size_t i = 0; i < sb->count; i++) {
+    memcpy(dst, GRPC_SLICE_START_PTR(sb->slices[i]),
+           GRPC_SLICE_LENGTH(sb->slices[i]));
+    dst += GRPC_SLICE_LENGTH(sb->slices[i]);
+  }
+  grpc_slice_buffer_reset_and_unref_internal(sb);
+  grpc_slice_buffer_add(sb, compacted);
+}
+
 static void continue_receiving_slices(batch_control* bctl) {
   grpc_error* error;
   grpc_call* call = bctl->call;
@@ -1252,6 +1302,7 @@ static void continue_receiving_slices(batch_control* bctl) {
     size_t remaining = call->receiving_stream->length() -
                        (*call->receiving_buffer)->data.raw.slice_buffer.length;
     if (remaining == 0) {
+      maybe_compact_received_message(call);
       call->receiving_message = 0;
       call->receiving_stream.reset();
       finish_batch_step(bctl);
@@ -1958,6 +2009,18 @@ done_with_error:
   goto done;
 }
 
+/* On a proposed grpc_call_start_batch_bulk (N calls, one flush): the
+   per-call costs it targets do not compose the way the proposal assumes.
+   The ExecCtx created below is a thread-local; 30 fan-out batches started
+   from one application thread already share one flush cadence if the
+   caller brackets them in a single grpc_core::ExecCtx scope (and when
+   started from inside a gRPC callback an ExecCtx is already active, so the
+   ctor/flush is the nested no-op case). The client_channel pick, by
+   contrast, is deliberately per-call: a shared "picker snapshot" across 30
+   calls would hand every one of them to the same subchannel, defeating the
+   load balancing policy - grouping transport ops per subchannel is only
+   valid after per-call picks have been made, at which point the transport
+   combiner already batches ops that arrive in one exec ctx flush. */
 grpc_call_error grpc_call_start_batch(grpc_call* call, const grpc_op* ops,
                                       size_t nops, void* tag, void* reserved) {
   grpc_call_error err;
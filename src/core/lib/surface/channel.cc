@@ -97,6 +97,9 @@ grpc_channel* grpc_channel_create_with_builder(
       &channel->call_size_estimate,
       (gpr_atm)CHANNEL_STACK_FROM_CHANNEL(channel)->call_stack_size +
           grpc_call_get_initial_size_estimate());
+  channel->call_size_estimate_floor = 0;
+  gpr_mu_init(&channel->call_arena_cache_mu);
+  channel->call_arena_cache_count = 0;
 
   grpc_compression_options_init(&channel->compression_options);
   for (size_t i = 0; i < args->num_args; i++) {
@@ -121,6 +124,17 @@ grpc_channel* grpc_channel_create_with_builder(
       channel->compression_options.enabled_algorithms_bitset =
           static_cast<uint32_t>(args->args[i].value.integer) |
           0x1; /* always support no compression */
+    } else if (0 == strcmp(args->args[i].key,
+                           GRPC_ARG_MIN_CALL_SIZE_ESTIMATE)) {
+      const int value =
+          grpc_channel_arg_get_integer(&args->args[i], {0, 0, INT_MAX});
+      channel->call_size_estimate_floor = static_cast<size_t>(value);
+      if (static_cast<size_t>(gpr_atm_no_barrier_load(
+              &channel->call_size_estimate)) < channel->call_size_estimate_floor) {
+        gpr_atm_no_barrier_store(
+            &channel->call_size_estimate,
+            static_cast<gpr_atm>(channel->call_size_estimate_floor));
+      }
     } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CHANNELZ_CHANNEL_NODE)) {
       GPR_ASSERT(args->args[i].type == GRPC_ARG_POINTER);
       GPR_ASSERT(args->args[i].value.pointer.p != nullptr);
@@ -304,6 +318,60 @@ size_t grpc_channel_get_call_size_estimate(grpc_channel* channel) {
          ~static_cast<size_t>(ROUND_UP_SIZE - 1);
 }
 
+grpc_core::Arena* grpc_channel_take_recycled_call_arena(grpc_channel* channel,
+                                                        size_t initial_size) {
+  grpc_core::Arena* arena = nullptr;
+  gpr_mu_lock(&channel->call_arena_cache_mu);
+  if (channel->call_arena_cache_count > 0) {
+    grpc_core::Arena* candidate =
+        channel->call_arena_cache[channel->call_arena_cache_count - 1];
+    if (candidate->initial_zone_size() == initial_size) {
+      arena = candidate;
+      channel->call_arena_cache_count--;
+    }
+    /* A size mismatch means the estimate moved; leave the stale arenas to be
+       evicted by recycle-time size checks and channel destruction. */
+  }
+  gpr_mu_unlock(&channel->call_arena_cache_mu);
+  return arena;
+}
+
+bool grpc_channel_recycle_call_arena(grpc_channel* channel,
+                                     grpc_core::Arena* arena) {
+  /* Arenas that overflowed signal an undersized estimate: let them die and
+     let the next call allocate at the (now larger) estimate. */
+  if (arena->HasOverflowZones() ||
+      arena->initial_zone_size() !=
+          grpc_channel_get_call_size_estimate(channel)) {
+    return false;
+  }
+  bool cached = false;
+  gpr_mu_lock(&channel->call_arena_cache_mu);
+  if (channel->call_arena_cache_count <
+      GPR_ARRAY_SIZE(channel->call_arena_cache)) {
+    /* Evict one stale-sized arena to make the cache self-cleaning when the
+       estimate drifts. */
+    if (channel->call_arena_cache_count > 0 &&
+        channel->call_arena_cache[0]->initial_zone_size() !=
+            arena->initial_zone_size()) {
+      grpc_core::Arena* stale = channel->call_arena_cache[0];
+      channel->call_arena_cache[0] =
+          channel->call_arena_cache[channel->call_arena_cache_count - 1];
+      channel->call_arena_cache_count--;
+      gpr_mu_unlock(&channel->call_arena_cache_mu);
+      stale->Destroy();
+      gpr_mu_lock(&channel->call_arena_cache_mu);
+    }
+    if (channel->call_arena_cache_count <
+        GPR_ARRAY_SIZE(channel->call_arena_cache)) {
+      channel->call_arena_cache[channel->call_arena_cache_count++] = arena;
+      cached = true;
+    }
+  }
+  gpr_mu_unlock(&channel->call_arena_cache_mu);
+  return cached;
+}
+
 void grpc_channel_update_call_size_estimate(grpc_channel* channel,
                                             size_t size) {
   size_t cur = static_cast<size_t>(
@@ -317,11 +385,18 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel,
   } else if (cur == size) {
     /* no change: holding pattern */
   } else if (cur > 0) {
-    /* size shrank: decrease estimate */
-    gpr_atm_no_barrier_cas(
-        &channel->call_size_estimate, static_cast<gpr_atm>(cur),
-        static_cast<gpr_atm>(GPR_MIN(cur - 1, (255 * cur + size) / 256)));
-    /* if we lose: never mind, something else will likely update soon enough */
+    /* size shrank: decrease estimate (but never below the configured floor,
+       so arenas pre-sized via GRPC_ARG_MIN_CALL_SIZE_ESTIMATE stay
+       pre-sized) */
+    const size_t decayed = GPR_MIN(cur - 1, (255 * cur + size) / 256);
+    const size_t next = GPR_MAX(decayed, channel->call_size_estimate_floor);
+    if (next < cur) {
+      gpr_atm_no_barrier_cas(&channel->call_size_estimate,
+                             static_cast<gpr_atm>(cur),
+                             static_cast<gpr_atm>(next));
+      /* if we lose: never mind, something else will likely update soon
+         enough */
+    }
   }
 }
 
@@ -481,6 +556,10 @@ static void destroy_channel(void* arg, grpc_error* /*error*/) {
         grpc_slice_from_static_string("Channel destroyed"));
     channel->channelz_node.reset();
   }
+  while (channel->call_arena_cache_count > 0) {
+    channel->call_arena_cache[--channel->call_arena_cache_count]->Destroy();
+  }
+  gpr_mu_destroy(&channel->call_arena_cache_mu);
   grpc_channel_stack_destroy(CHANNEL_STACK_FROM_CHANNEL(channel));
   while (channel->registered_calls) {
     registered_call* rc = channel->registered_calls;
@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -58,12 +59,33 @@ grpc_core::channelz::ChannelNode* grpc_channel_get_channelz_node(
 size_t grpc_channel_get_call_size_estimate(grpc_channel* channel);
 void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
+/** Pops a recycled call arena whose initial zone is exactly \a initial_size
+    bytes, or returns nullptr. */
+grpc_core::Arena* grpc_channel_take_recycled_call_arena(grpc_channel* channel,
+                                                        size_t initial_size);
+/** Offers a completed call's arena for reuse by a later call on this
+    channel. Returns false (caller keeps ownership and should Destroy) if the
+    cache is full or the arena does not match the channel's current call size
+    estimate; arenas that overflowed into extra zones are never recycled. */
+bool grpc_channel_recycle_call_arena(grpc_channel* channel,
+                                     grpc_core::Arena* arena);
+
 struct registered_call;
 struct grpc_channel {
   int is_client;
   grpc_compression_options compression_options;
 
   gpr_atm call_size_estimate;
+  /* cache of recycled call arenas (protected by call_arena_cache_mu); every
+     cached arena is zone-free and its initial zone matched the call size
+     estimate when it was recycled */
+  gpr_mu call_arena_cache_mu;
+  grpc_core::Arena* call_arena_cache[8];
+  size_t call_arena_cache_count;
+  /* Floor for call_size_estimate (from
+     GRPC_ARG_MIN_CALL_SIZE_ESTIMATE): the estimator never decays below
+     this, so pre-sized arenas stay pre-sized. */
+  size_t call_size_estimate_floor;
   grpc_resource_user* resource_user;
 
   gpr_mu registered_call_mu;
@@ -34,6 +34,7 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/tls.h"
 #include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/pollset.h"
 #include "src/core/lib/iomgr/timer.h"
@@ -204,6 +205,9 @@ struct cq_vtable {
                  void* done_arg, grpc_cq_completion* storage, bool internal);
   grpc_event (*next)(grpc_completion_queue* cq, gpr_timespec deadline,
                      void* reserved);
+  size_t (*next_batch)(grpc_completion_queue* cq, grpc_event* events,
+                       size_t max_events, gpr_timespec deadline,
+                       void* reserved);
   grpc_event (*pluck)(grpc_completion_queue* cq, void* tag,
                       gpr_timespec deadline, void* reserved);
 };
@@ -294,6 +298,16 @@ struct cq_pluck_data {
   plucker pluckers[GRPC_MAX_COMPLETION_QUEUE_PLUCKERS];
 };
 
+/* Registered-ring note (proposed 4th cq type): completions for callback
+   cqs do not take an executor hop in the common case - cq_end_op_for_
+   callback invokes the functor inline unless it must leave an internal
+   thread - so a preregistered tag-slot ring would mainly replace the
+   functor indirection with an atomic publish. The blocker is completion
+   *payload* lifetime: a grpc_cq_completion is transport-owned storage
+   released by the done() callback at consumption time; parking results in
+   an app-owned ring means the core-side storage must be copied out or
+   held until the app consumes the slot, i.e. the ring needs its own
+   done-deferral protocol. Design that before adding the cq type. */
 struct cq_callback_data {
   cq_callback_data(
       grpc_experimental_completion_queue_functor* shutdown_callback)
@@ -327,6 +341,13 @@ struct grpc_completion_queue {
   const cq_vtable* vtable;
   const cq_poller_vtable* poller_vtable;
 
+  /** The pollset this cq polls: either the storage inline after the cq data,
+      or - when sharing - the donor cq's pollset */
+  grpc_pollset* pollset;
+  /** Non-null iff this cq borrows its pollset from another cq; holds a ref
+      on the donor until this cq is destroyed */
+  grpc_completion_queue* pollset_donor;
+
 #ifndef NDEBUG
   void** outstanding_tags;
   size_t outstanding_tag_count;
@@ -373,6 +394,10 @@ static void cq_end_op_for_callback(
 static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
                           void* reserved);
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved);
+
 static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
                            gpr_timespec deadline, void* reserved);
 
@@ -392,19 +417,22 @@ static const cq_vtable g_cq_vtable[] = {
     /* GRPC_CQ_NEXT */
     {GRPC_CQ_NEXT, sizeof(cq_next_data), cq_init_next, cq_shutdown_next,
      cq_destroy_next, cq_begin_op_for_next, cq_end_op_for_next, cq_next,
-     nullptr},
+     cq_next_batch, nullptr},
     /* GRPC_CQ_PLUCK */
     {GRPC_CQ_PLUCK, sizeof(cq_pluck_data), cq_init_pluck, cq_shutdown_pluck,
      cq_destroy_pluck, cq_begin_op_for_pluck, cq_end_op_for_pluck, nullptr,
-     cq_pluck},
+     nullptr, cq_pluck},
     /* GRPC_CQ_CALLBACK */
     {GRPC_CQ_CALLBACK, sizeof(cq_callback_data), cq_init_callback,
      cq_shutdown_callback, cq_destroy_callback, cq_begin_op_for_callback,
-     cq_end_op_for_callback, nullptr, nullptr},
+     cq_end_op_for_callback, nullptr, nullptr, nullptr},
 };
 
 #define DATA_FROM_CQ(cq) ((void*)(cq + 1))
-#define POLLSET_FROM_CQ(cq) \
+#define POLLSET_FROM_CQ(cq) (cq->pollset)
+/* where the pollset lives when this cq owns one (set into cq->pollset at
+   creation; borrowing cqs point at their donor's pollset instead) */
+#define INLINE_POLLSET_FROM_CQ(cq) \
   ((grpc_pollset*)(cq->vtable->data_size + (char*)DATA_FROM_CQ(cq)))
 
 grpc_core::TraceFlag grpc_cq_pluck_trace(false, "queue_pluck");
@@ -422,7 +450,18 @@ grpc_core::TraceFlag grpc_cq_pluck_trace(false, "queue_pluck");
 
 static void on_pollset_shutdown_done(void* cq, grpc_error* error);
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_cq_spin_iterations, 0,
+    "Number of times grpc_completion_queue_next re-checks the event queue "
+    "before parking in the polling engine (busy-spin-then-park). 0 parks "
+    "immediately. Latency-sensitive deployments with dedicated polling "
+    "threads can set this to trade CPU for up to a futex wake/sleep cycle "
+    "per event.");
+
+static int g_cq_spin_iterations = 0;
+
 void grpc_cq_global_init() {
+  g_cq_spin_iterations = GPR_GLOBAL_CONFIG_GET(grpc_cq_spin_iterations);
   gpr_tls_init(&g_cached_event);
   gpr_tls_init(&g_cached_cq);
 }
@@ -493,7 +532,8 @@ grpc_cq_completion* CqEventQueue::Pop() {
 
 grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
-    grpc_experimental_completion_queue_functor* shutdown_callback) {
+    grpc_experimental_completion_queue_functor* shutdown_callback,
+    grpc_completion_queue* pollset_donor) {
   GPR_TIMER_SCOPE("grpc_completion_queue_create_internal", 0);
 
   grpc_completion_queue* cq;
@@ -507,12 +547,25 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
   const cq_poller_vtable* poller_vtable =
       &g_poller_vtable_by_poller_type[polling_type];
 
+  /* Borrow the donor's pollset only when both sides actually poll; the
+     donor must own its pollset (no chained borrowing). */
+  const bool borrow_pollset =
+      pollset_donor != nullptr && poller_vtable->can_get_pollset &&
+      pollset_donor->poller_vtable->can_get_pollset &&
+      pollset_donor->pollset_donor == nullptr;
+  if (pollset_donor != nullptr && !borrow_pollset) {
+    gpr_log(GPR_ERROR,
+            "Ignoring cq_shared_pollset_donor %p: the donor must own a "
+            "pollset and both queues must be polling",
+            pollset_donor);
+  }
+
   grpc_core::ExecCtx exec_ctx;
   GRPC_STATS_INC_CQS_CREATED();
 
   cq = static_cast<grpc_completion_queue*>(
       gpr_zalloc(sizeof(grpc_completion_queue) + vtable->data_size +
-                 poller_vtable->size()));
+                 (borrow_pollset ? 0 : poller_vtable->size())));
 
   cq->vtable = vtable;
   cq->poller_vtable = poller_vtable;
@@ -520,7 +573,15 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
   /* One for destroy(), one for pollset_shutdown */
   new (&cq->owning_refs) grpc_core::RefCount(2);
 
-  poller_vtable->init(POLLSET_FROM_CQ(cq), &cq->mu);
+  if (borrow_pollset) {
+    GRPC_CQ_INTERNAL_REF(pollset_donor, "pollset_donor");
+    cq->pollset_donor = pollset_donor;
+    cq->pollset = pollset_donor->pollset;
+    cq->mu = pollset_donor->mu;
+  } else {
+    cq->pollset = INLINE_POLLSET_FROM_CQ(cq);
+    poller_vtable->init(cq->pollset, &cq->mu);
+  }
   vtable->init(DATA_FROM_CQ(cq), shutdown_callback);
 
   GRPC_CLOSURE_INIT(&cq->pollset_shutdown_done, on_pollset_shutdown_done, cq,
@@ -600,7 +661,11 @@ void grpc_cq_internal_unref(grpc_completion_queue* cq) {
 #endif
   if (GPR_UNLIKELY(cq->owning_refs.Unref(debug_location, reason))) {
     cq->vtable->destroy(DATA_FROM_CQ(cq));
-    cq->poller_vtable->destroy(POLLSET_FROM_CQ(cq));
+    if (cq->pollset_donor != nullptr) {
+      GRPC_CQ_INTERNAL_UNREF(cq->pollset_donor, "pollset_donor");
+    } else {
+      cq->poller_vtable->destroy(POLLSET_FROM_CQ(cq));
+    }
 #ifndef NDEBUG
     gpr_free(cq->outstanding_tags);
 #endif
@@ -1031,6 +1096,21 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       break;
     }
 
+    /* Busy-spin-then-park: optionally re-check the event queue a bounded
+       number of times before paying the futex park/wake cycle in the
+       poller. Only spin when we would otherwise block (nonzero iteration
+       deadline). */
+    if (g_cq_spin_iterations > 0 && iteration_deadline != 0) {
+      bool spun_into_work = false;
+      for (int spin = 0; spin < g_cq_spin_iterations; spin++) {
+        if (cqd->queue.num_items() > 0) {
+          spun_into_work = true;
+          break;
+        }
+      }
+      if (spun_into_work) continue;
+    }
+
     /* The main polling work happens in grpc_pollset_work */
     gpr_mu_lock(cq->mu);
     cq->num_polls++;
@@ -1066,6 +1146,18 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
   return ret;
 }
 
+/* Shut down this cq's pollset, or - when the pollset is borrowed - skip
+   straight to the shutdown-done callback: the donor owns pollset shutdown,
+   and borrowers are required to shut down before it. */
+static void cq_shutdown_pollset(grpc_completion_queue* cq) {
+  if (cq->pollset_donor != nullptr) {
+    GRPC_CLOSURE_SCHED(&cq->pollset_shutdown_done, GRPC_ERROR_NONE);
+  } else {
+    cq->poller_vtable->shutdown(POLLSET_FROM_CQ(cq),
+                                &cq->pollset_shutdown_done);
+  }
+}
+
 /* Finishes the completion queue shutdown. This means that there are no more
    completion events / tags expected from the completion queue
    - Must be called under completion queue lock
@@ -1078,7 +1170,7 @@ static void cq_finish_shutdown_next(grpc_completion_queue* cq) {
   GPR_ASSERT(cqd->shutdown_called);
   GPR_ASSERT(cqd->pending_events.Load(grpc_core::MemoryOrder::RELAXED) == 0);
 
-  cq->poller_vtable->shutdown(POLLSET_FROM_CQ(cq), &cq->pollset_shutdown_done);
+  cq_shutdown_pollset(cq);
 }
 
 static void cq_shutdown_next(grpc_completion_queue* cq) {
@@ -1108,11 +1200,76 @@ static void cq_shutdown_next(grpc_completion_queue* cq) {
   GRPC_CQ_INTERNAL_UNREF(cq, "shutting_down");
 }
 
+/* Dequeue up to max_events events with a single blocking wait. Blocks (up to
+   deadline) only until the first event is available; once one event has been
+   dequeued, additional already-completed events are popped without polling.
+   A GRPC_QUEUE_SHUTDOWN or GRPC_QUEUE_TIMEOUT event is only ever written to
+   events[0] (i.e when nothing was dequeued). */
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved) {
+  GPR_TIMER_SCOPE("grpc_completion_queue_next_batch", 0);
+  GPR_ASSERT(max_events > 0);
+
+  /* Wait for the first event (or timeout/shutdown) re-using the full polling
+     logic of cq_next */
+  events[0] = cq_next(cq, deadline, reserved);
+  if (events[0].type != GRPC_OP_COMPLETE) {
+    return 1;
+  }
+  size_t count = 1;
+
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+  GRPC_CQ_INTERNAL_REF(cq, "next_batch");
+  grpc_core::ExecCtx exec_ctx; /* needed by the done callbacks */
+  while (count < max_events) {
+    grpc_cq_completion* c = cqd->queue.Pop();
+    if (c == nullptr) {
+      /* Empty (or transiently inconsistent - in which case the next call
+         will pick the stragglers up; do not spin here). */
+      break;
+    }
+    events[count].type = GRPC_OP_COMPLETE;
+    events[count].success = c->next & 1u;
+    events[count].tag = c->tag;
+    c->done(c->done_arg, c);
+    count++;
+  }
+
+  /* If there is still work queued, make sure some poller is awake to hand it
+     to the next caller (mirrors the tail of cq_next()). */
+  if (cqd->queue.num_items() > 0 &&
+      cqd->pending_events.Load(grpc_core::MemoryOrder::ACQUIRE) > 0) {
+    gpr_mu_lock(cq->mu);
+    cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
+    gpr_mu_unlock(cq->mu);
+  }
+
+  GRPC_CQ_INTERNAL_UNREF(cq, "next_batch");
+  return count;
+}
+
 grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                       gpr_timespec deadline, void* reserved) {
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline, void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch(cq=%p, events=%p, max_events=%" PRIuPTR
+      ", "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  GPR_ASSERT(cq->vtable->next_batch != nullptr);
+  return cq->vtable->next_batch(cq, events, max_events, deadline, reserved);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -1314,7 +1471,7 @@ static void cq_finish_shutdown_pluck(grpc_completion_queue* cq) {
   GPR_ASSERT(!cqd->shutdown.Load(grpc_core::MemoryOrder::RELAXED));
   cqd->shutdown.Store(1, grpc_core::MemoryOrder::RELAXED);
 
-  cq->poller_vtable->shutdown(POLLSET_FROM_CQ(cq), &cq->pollset_shutdown_done);
+  cq_shutdown_pollset(cq);
 }
 
 /* NOTE: This function is almost exactly identical to cq_shutdown_next() but
@@ -1349,7 +1506,7 @@ static void cq_finish_shutdown_callback(grpc_completion_queue* cq) {
 
   GPR_ASSERT(cqd->shutdown_called);
 
-  cq->poller_vtable->shutdown(POLLSET_FROM_CQ(cq), &cq->pollset_shutdown_done);
+  cq_shutdown_pollset(cq);
   if (grpc_iomgr_is_any_background_poller_thread()) {
     grpc_core::ApplicationCallbackExecCtx::Enqueue(callback, true);
     return;
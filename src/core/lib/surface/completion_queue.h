@@ -90,8 +90,12 @@ grpc_cq_completion_type grpc_get_cq_completion_type(grpc_completion_queue* cc);
 
 int grpc_get_cq_poll_num(grpc_completion_queue* cc);
 
+/* pollset_donor, if non-null, names a cq whose pollset the new cq polls
+   instead of creating its own (see cq_shared_pollset_donor in
+   grpc_completion_queue_attributes). */
 grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
-    grpc_experimental_completion_queue_functor* shutdown_callback);
+    grpc_experimental_completion_queue_functor* shutdown_callback,
+    grpc_completion_queue* pollset_donor = nullptr);
 
 #endif /* GRPC_CORE_LIB_SURFACE_COMPLETION_QUEUE_H */
@@ -200,6 +200,15 @@ struct request_matcher {
   grpc_server* server;
   call_data* pending_head;
   call_data* pending_tail;
+  /* One queue of application-requested calls per completion queue. The
+     matcher's fast path is already sharded and lock-free: request_call
+     Pushes without a lock, and incoming RPCs TryPop starting from their
+     channel's own cq (cache locality), falling back to the other shards.
+     server->mu_call is only taken on the slow path - when every shard
+     appeared empty and the call must go to the pending list - which is the
+     overload regime where admission, not matching, is the bottleneck. A
+     bounded MPMC ring would change the empty/non-empty race but not remove
+     any lock from the steady-state dispatch path. */
   LockedMultiProducerSingleConsumerQueue* requests_per_cq;
 };
 
@@ -612,6 +621,19 @@ static void finish_start_new_rpc(
   }
 }
 
+/* Admission-control placement note: "reject before any call stack is
+   constructed" is not achievable for per-METHOD limits in this
+   architecture - the method is carried in HPACK-compressed headers that
+   only the already-constructed call stack's parser decodes, so the
+   earliest method-aware gate is right here, after stack init but before
+   matching/publishing (where a rejection still saves the application
+   handler, matcher queueing and all response-side work). Pre-stack gates
+   can only be connection-granular: MAX_CONCURRENT_STREAMS (including the
+   adaptive pressure-driven variant) and the resource-quota check in the
+   server accept path, which are the knobs that protect arena/filter
+   setup itself. A per-method counter gate here would be a relaxed-atomic
+   inc/dec keyed off rm->server_registered_method; the policy surface
+   (limits per method via ServerBuilder) is the part that needs design. */
 static void start_new_rpc(grpc_call_element* elem) {
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
   call_data* calld = static_cast<call_data*>(elem->call_data);
@@ -621,6 +643,14 @@ static void start_new_rpc(grpc_call_element* elem) {
   channel_registered_method* rm;
 
   if (chand->registered_methods && calld->path_set && calld->host_set) {
+    /* Dispatch cost note (re: generator-emitted constexpr method tables):
+       this per-channel table is built once at channel creation with
+       interned slices, slice comparisons here are pointer identity
+       (rm->method != calld->path), and the hash of an interned path is
+       cached in its refcount - so resolving a method on a warm connection
+       is a probe or two of pointer compares, not string hashing. Codegen
+       cannot precompute these hashes anyway: the interning hash seed is
+       randomized per process. */
     /* TODO(ctiller): unify these two searches */
     /* check for an exact match with host */
     hash = GRPC_MDSTR_KV_HASH(grpc_slice_hash_internal(calld->host),
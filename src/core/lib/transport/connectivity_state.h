@@ -86,6 +86,15 @@ class AsyncConnectivityStateWatcherInterface
 // Note that once the state becomes SHUTDOWN, watchers will be notified
 // and then automatically orphaned (i.e., RemoveWatcher() does not need
 // to be called).
+//
+// Concurrency/scaling note: polling the current state via state() is a
+// single relaxed-ish atomic load - the state word doubles as the "epoch"
+// for no-change detection, so tooling that polls tens of thousands of
+// channels takes no lock and causes no cross-thread traffic unless the
+// state actually changed. There is no tracker mutex at all: watcher-list
+// mutation and SetState are serialized by the owner's combiner, and
+// watchers are only visited (and closures only scheduled) on an actual
+// state transition.
 class ConnectivityStateTracker {
  public:
   ConnectivityStateTracker(const char* name,
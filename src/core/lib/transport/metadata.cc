@@ -95,7 +95,7 @@ void grpc_mdelem_trace_unref(void* md, const grpc_slice& key,
 #endif  // ifndef NDEBUG
 
 #define INITIAL_SHARD_CAPACITY 8
-#define LOG2_SHARD_COUNT 4
+#define LOG2_SHARD_COUNT 6
 #define SHARD_COUNT ((size_t)(1 << LOG2_SHARD_COUNT))
 
 #define TABLE_IDX(hash, capacity) (((hash) >> (LOG2_SHARD_COUNT)) % (capacity))
@@ -216,15 +216,22 @@ size_t InternedMetadata::CleanupLinkedMetadata(
   return num_freed;
 }
 
+/* Each shard is padded out to a cacheline so that neighbouring shards' locks
+   and counters do not false-share under concurrent call setup. */
 typedef struct mdtab_shard {
-  gpr_mu mu;
-  InternedMetadata::BucketLink* elems;
-  size_t count;
-  size_t capacity;
-  /** Estimate of the number of unreferenced mdelems in the hash table.
-      This will eventually converge to the exact number, but it's instantaneous
-      accuracy is not guaranteed */
-  gpr_atm free_estimate;
+  union {
+    char pad[GPR_CACHELINE_SIZE];
+    struct {
+      gpr_mu mu;
+      InternedMetadata::BucketLink* elems;
+      size_t count;
+      size_t capacity;
+      /** Estimate of the number of unreferenced mdelems in the hash table.
+          This will eventually converge to the exact number, but it's
+          instantaneous accuracy is not guaranteed */
+      gpr_atm free_estimate;
+    };
+  };
 } mdtab_shard;
 
 static mdtab_shard g_shards[SHARD_COUNT];
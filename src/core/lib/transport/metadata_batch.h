@@ -46,6 +46,20 @@ typedef struct grpc_mdelem_list {
   grpc_linked_mdelem* tail;
 } grpc_mdelem_list;
 
+/* Representation note: a flat arena-backed array (inline capacity ~16,
+   index-based callouts, bulk append from the hpack parser) has been
+   proposed to replace this linked list so filters walk contiguous memory.
+   Two properties block a drop-in swap and must be designed around first:
+   (a) grpc_linked_mdelem storage is owned by *callers* (filters embed
+   links in their call data and in send_extra_metadata arrays) and its
+   address is stable for the life of the batch - an array representation
+   moves elements, so every filter's remove/substitute-by-pointer usage
+   changes API; and (b) the callout index holds interior pointers to those
+   links for O(1) well-known-key lookup, which array indices can replace
+   only once (a) is done. Until that cross-cutting migration happens,
+   locality in practice is better than a generic list: links for a
+   received batch are allocated sequentially from the call arena by the
+   parser, so iteration mostly walks one arena zone in order. */
 typedef struct grpc_metadata_batch {
   /** Metadata elements in this batch */
   grpc_mdelem_list list;
@@ -1177,6 +1177,9 @@ uintptr_t grpc_static_mdelem_user_data[GRPC_STATIC_MDELEM_COUNT] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 6, 6, 8, 8, 2, 4, 4};
 
+/* Generated minimal perfect hash for the static metadata table: two
+   arithmetic ops, one displacement-table load and one key compare resolve
+   any static (key, value) pair with no collision probing. */
 static const int8_t elems_r[] = {
     15, 10, -8, 0,  2,  -43, -82, -43, 0,   4,   -8,  0,   0,  0,  8,  -2,
     -9, 0,  0,  2,  1,  0,   0,   0,   0,   0,   0,   0,   0,  0,  0,  0,
@@ -77,6 +77,16 @@ static void enc_millis(char* buffer, int64_t x) {
   }
 }
 
+/* Cache note ("~6 distinct deadline values" workloads): a value->slice
+   cache keyed on rounded millis does not pay for itself here. The encoder
+   below is a handful of integer divisions with no allocation (callers
+   provide the buffer), and - critically - the encoded value is computed
+   from deadline-minus-now at send time, so two calls with the same
+   configured deadline produce *different* milli counts; hits would only
+   occur after the same coarse rounding the encoder is about to do anyway.
+   The parse side already caches: grpc_http2_decode_timeout results ride on
+   interned metadata values, so repeated identical grpc-timeout headers
+   decode once per table lifetime. */
 void grpc_http2_encode_timeout(grpc_millis timeout, char* buffer) {
   const grpc_millis kMaxTimeout = 99999999000;
   if (timeout <= 0) {
@@ -28,6 +28,28 @@ typedef struct grpc_transport_vtable {
      layers and initialized by the transport */
   size_t sizeof_stream; /* = sizeof(transport stream) */
 
+  /* Guidance for proposed same-host transports (memfd/SCM_RIGHTS fd-passing
+     over UDS, shared-memory SPSC rings): both slot cleanly behind this
+     vtable - inproc_transport.cc is the minimal worked example of a
+     non-chttp2 transport, and nothing in the API assumes a byte stream.
+     The hard parts are outside the vtable and should be designed first
+     (these apply equally to a QUIC transport scaffold - datagram transports
+     additionally bring their own flow control and stream lifecycle, and a
+     pluggable QUIC library boundary means the vtable implementation is a
+     thin adapter over the library's streams; the subchannel connect path
+     gains 0-RTT by letting the connector return a transport before the
+     handshake completes, which the handshake-manager API does not express
+     today):
+     (1) negotiation - both peers must agree to the transport before the
+     first byte, which today means a distinct scheme/channel factory rather
+     than upgrading an established UDS connection; (2) lifetime of
+     cross-process memory - a sealed memfd or ring segment outlives a
+     crashing peer, so ownership and cleanup need an explicit protocol
+     (O_TMPFILE + seals helps for memfd; shm needs a liveness heartbeat);
+     (3) flow control must be rebuilt (no kernel socket buffer to lean on -
+     the ring/fd-count is the window). An in-tree implementation that skips
+     any of these is worse than localhost TCP with local_credentials. */
+
   /* name of this transport implementation */
   const char* name;
 
@@ -258,6 +258,17 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
   return self->vtable->get_unused_bytes(self, bytes, bytes_size);
 }
 
+tsi_result tsi_handshaker_result_take_unused_bytes(tsi_handshaker_result* self,
+                                                   unsigned char** bytes,
+                                                   size_t* bytes_size) {
+  if (self == nullptr || self->vtable == nullptr || bytes == nullptr ||
+      bytes_size == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->take_unused_bytes == nullptr) return TSI_UNIMPLEMENTED;
+  return self->vtable->take_unused_bytes(self, bytes, bytes_size);
+}
+
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
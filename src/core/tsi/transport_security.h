@@ -104,6 +104,13 @@ typedef struct {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  /* Optional (may be null; placed last so existing positional initializers
+     keep working): transfer ownership of the unused bytes to the caller
+     instead of lending a pointer, so the security handshaker can hand them
+     to the endpoint without a copy. See
+     tsi_handshaker_result_take_unused_bytes. */
+  tsi_result (*take_unused_bytes)(tsi_handshaker_result* self,
+                                  unsigned char** bytes, size_t* bytes_size);
 } tsi_handshaker_result_vtable;
 
 struct tsi_handshaker_result {
@@ -232,6 +232,16 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* byte_size);
 
+/* Like tsi_handshaker_result_get_unused_bytes, but transfers ownership of
+   the bytes (allocated with gpr_malloc) to the caller, who must gpr_free
+   them; the handshaker result forgets them, and subsequent get/take calls
+   return zero bytes. Returns TSI_UNIMPLEMENTED if the implementation does
+   not support ownership transfer, in which case the caller should fall
+   back to get_unused_bytes and copy. */
+tsi_result tsi_handshaker_result_take_unused_bytes(tsi_handshaker_result* self,
+                                                   unsigned char** bytes,
+                                                   size_t* byte_size);
+
 /* This method releases the tsi_handshaker_handshaker object. After this method
    is called, no other method can be called on the object.  */
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
@@ -16,6 +16,7 @@
  *
  */
 
+#include <grpcpp/impl/codegen/callback_common.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/grpc_library.h>
 
@@ -28,3 +29,5 @@
 
 grpc::CoreCodegenInterface* grpc::g_core_codegen_interface;
 grpc::GrpcLibraryInterface* grpc::g_glip;
+grpc::experimental::CallbackExecutorInterface* grpc::internal::
+    g_callback_executor;
@@ -34,6 +34,17 @@
 namespace grpc_impl {
 
 namespace internal {
+/* Allocation profile (re: pooled alarms for very large alarm counts): one
+   AlarmImpl is heap-allocated per grpc::Alarm and reused across every
+   Set - the timer, closure, and grpc_cq_completion are all embedded, so
+   re-arming and firing are allocation-free; the cq completion rides the
+   embedded completion_ storage straight into the event queue. What an arm
+   storm pays per alarm is the timer-shard lock in grpc_timer_init. Since
+   shard selection is CPU-based, one thread arming thousands of alarms
+   hits a single (uncontended) shard lock repeatedly; if profiles show
+   that lock as a cost, the extension point is a grpc_timer_init_batch
+   mirroring grpc_timer_cancel_batch's group-by-shard structure, plus a
+   bulk Set here that feeds it. */
 class AlarmImpl : public ::grpc::internal::CompletionQueueTag {
  public:
   AlarmImpl() : cq_(nullptr), tag_(nullptr) {
@@ -64,6 +64,46 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, size_t max_events, size_t* num_events,
+    gpr_timespec deadline) {
+  GPR_ASSERT(max_events > 0);
+  *num_events = 0;
+  // Collect core events in stack-allocated chunks; most event loops ask for
+  // modest batches anyway.
+  constexpr size_t kMaxChunk = 64;
+  grpc_event events[kMaxChunk];
+  size_t out = 0;
+  // Loop in case every dequeued event is swallowed by FinalizeResult (as in
+  // AsyncNextInternal).
+  while (out == 0) {
+    const size_t n = grpc_completion_queue_next_batch(
+        cq_, events, max_events < kMaxChunk ? max_events : kMaxChunk, deadline,
+        nullptr);
+    for (size_t i = 0; i < n; i++) {
+      switch (events[i].type) {
+        case GRPC_QUEUE_TIMEOUT:
+          return TIMEOUT;
+        case GRPC_QUEUE_SHUTDOWN:
+          return SHUTDOWN;
+        case GRPC_OP_COMPLETE:
+          auto core_cq_tag =
+              static_cast<::grpc::internal::CompletionQueueTag*>(events[i].tag);
+          bool ok = events[i].success != 0;
+          void* tag = core_cq_tag;
+          if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+            tags[out] = tag;
+            oks[out] = ok;
+            out++;
+          }
+          break;
+      }
+    }
+  }
+  *num_events = out;
+  return GOT_EVENT;
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
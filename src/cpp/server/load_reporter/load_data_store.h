@@ -299,6 +299,17 @@ class PerHostStore {
 // all the stores should be fine for PerHostStore, since we assume there
 // should only be a few hostnames. But it's a potential problem for
 // PerBalancerStore.
+// Sharding note (fleet-wide enablement cost): per-call recording reaches
+// this store through the server load reporting filter, which serializes on
+// the store's lock from every worker thread. Sharding the store per worker
+// with merge-on-report is the right shape, but the key design constraint is
+// that in-progress call counts must decrement on the SAME shard that
+// incremented them (calls migrate threads between start and end), so shards
+// must be keyed by a stable per-call token rather than the current thread.
+// The complementary CPU-attribution ask is orthogonal: per-call
+// clock_gettime pairs can be replaced by sampling only if the report
+// consumer accepts statistical attribution - that is a protocol/consumer
+// decision, not a store implementation detail.
 class LoadDataStore {
  public:
   // Returns null if not found. Caller doesn't own the returned store.
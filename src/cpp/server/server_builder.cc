@@ -101,6 +101,11 @@ ServerBuilder& ServerBuilder::RegisterAsyncGenericService(
   return *this;
 }
 
+void ServerBuilder::experimental_type::SetCallbackExecutor(
+    grpc::experimental::CallbackExecutorInterface* executor) {
+  grpc::internal::g_callback_executor = executor;
+}
+
 ServerBuilder& ServerBuilder::experimental_type::RegisterCallbackGenericService(
     grpc::experimental::CallbackGenericService* service) {
   if (builder_->generic_service_ || builder_->callback_generic_service_) {
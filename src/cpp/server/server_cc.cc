@@ -352,6 +352,15 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     grpc_metadata_array_destroy(&request_metadata_);
   }
 
+  // Note on per-RPC cost: SyncRequest objects themselves are already pooled
+  // and re-armed (Request() is called repeatedly on the same object), so the
+  // bookkeeping allocated per RPC is (a) this pluck completion queue and (b)
+  // one requested_call slot inside core, enqueued with a lock-free push
+  // (server->mu_call_ is not taken on the matching fast path). The cq cannot
+  // be pooled without new core API: each in-flight RPC owns its cq until the
+  // call completes, and completion queues have no reset/reuse semantics. A
+  // batched request-N-slots core API would still need one cq + one slot per
+  // outstanding RPC, so it would not reduce either allocation.
   void SetupRequest() { cq_ = grpc_completion_queue_create_for_pluck(nullptr); }
 
   void TeardownRequest() {
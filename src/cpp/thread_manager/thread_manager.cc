@@ -22,9 +22,17 @@
 #include <mutex>
 
 #include <grpc/support/log.h>
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_sync_server_worker_grace_ms, 0,
+    "How long (in milliseconds) a surplus sync-server worker thread waits "
+    "for a poller slot to open before exiting. 0 exits immediately (the "
+    "historical behavior); a positive value keeps threads warm across "
+    "bursts instead of destroying and recreating them.");
+
 namespace grpc {
 
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
@@ -53,7 +61,9 @@ ThreadManager::WorkerThread::~WorkerThread() {
 ThreadManager::ThreadManager(const char* name,
                              grpc_resource_quota* resource_quota,
                              int min_pollers, int max_pollers)
-    : shutdown_(false),
+    : worker_grace_period_ms_(
+          GPR_GLOBAL_CONFIG_GET(grpc_sync_server_worker_grace_ms)),
+      shutdown_(false),
       num_pollers_(0),
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
@@ -83,6 +93,8 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  // Wake any workers parked waiting for a poller slot.
+  poller_slot_cv_.Broadcast();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -156,6 +168,11 @@ void ThreadManager::MainWorkLoop() {
     grpc_core::ReleasableMutexLock lock(&mu_);
     // Reduce the number of pollers by 1 and check what happened with the poll
     num_pollers_--;
+    if (worker_grace_period_ms_ > 0) {
+      // A poller slot just opened: give a parked warm thread a chance to
+      // claim it.
+      poller_slot_cv_.Signal();
+    }
     bool done = false;
     switch (work_status) {
       case TIMEOUT:
@@ -248,6 +265,21 @@ void ThreadManager::MainWorkLoop() {
     // avalanche.
     if (num_pollers_ < max_pollers_) {
       num_pollers_++;
+    } else if (worker_grace_period_ms_ > 0 && !shutdown_) {
+      // Warm-thread hysteresis: rather than exiting now and paying thread
+      // creation again moments later when the burst returns, park for the
+      // grace period waiting for a poller slot to open.
+      const gpr_timespec deadline = gpr_time_add(
+          gpr_now(GPR_CLOCK_REALTIME),
+          gpr_time_from_millis(worker_grace_period_ms_, GPR_TIMESPAN));
+      bool timed_out = false;
+      while (!shutdown_ && num_pollers_ >= max_pollers_ && !timed_out) {
+        timed_out = poller_slot_cv_.Wait(&mu_, deadline) != 0;
+      }
+      if (shutdown_ || num_pollers_ >= max_pollers_) {
+        break;
+      }
+      num_pollers_++;
     } else {
       break;
     }
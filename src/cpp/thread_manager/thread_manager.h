@@ -146,6 +146,11 @@ class ThreadManager {
   // Protects shutdown_, num_pollers_, num_threads_ and
   // max_active_threads_sofar_
   grpc_core::Mutex mu_;
+  // If > 0 (GRPC_SYNC_SERVER_WORKER_GRACE_MS), surplus worker threads park
+  // on this cv for that grace period waiting for a poller slot instead of
+  // exiting, avoiding thread churn under bursty load.
+  grpc_core::CondVar poller_slot_cv_;
+  int worker_grace_period_ms_;
 
   bool shutdown_;
   grpc_core::CondVar shutdown_cv_;
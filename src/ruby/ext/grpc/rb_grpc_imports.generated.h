@@ -119,6 +119,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef size_t(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, size_t max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -263,6 +266,9 @@ extern grpc_resource_quota_resize_type grpc_resource_quota_resize_import;
 typedef void(*grpc_resource_quota_set_max_threads_type)(grpc_resource_quota* resource_quota, int new_max_threads);
 extern grpc_resource_quota_set_max_threads_type grpc_resource_quota_set_max_threads_import;
 #define grpc_resource_quota_set_max_threads grpc_resource_quota_set_max_threads_import
+typedef void(*grpc_resource_quota_set_trim_callback_type)(grpc_resource_quota* resource_quota, void (*trim)(void* user_data), void* user_data);
+extern grpc_resource_quota_set_trim_callback_type grpc_resource_quota_set_trim_callback_import;
+#define grpc_resource_quota_set_trim_callback grpc_resource_quota_set_trim_callback_import
 typedef const grpc_arg_pointer_vtable*(*grpc_resource_quota_arg_vtable_type)(void);
 extern grpc_resource_quota_arg_vtable_type grpc_resource_quota_arg_vtable_import;
 #define grpc_resource_quota_arg_vtable grpc_resource_quota_arg_vtable_import
@@ -413,6 +419,9 @@ extern grpc_ssl_server_credentials_options_destroy_type grpc_ssl_server_credenti
 typedef grpc_server_credentials*(*grpc_ssl_server_credentials_create_with_options_type)(grpc_ssl_server_credentials_options* options);
 extern grpc_ssl_server_credentials_create_with_options_type grpc_ssl_server_credentials_create_with_options_import;
 #define grpc_ssl_server_credentials_create_with_options grpc_ssl_server_credentials_create_with_options_import
+typedef void(*grpc_ssl_server_credentials_set_session_ticket_key_type)(grpc_server_credentials* creds, const char* key, size_t key_size);
+extern grpc_ssl_server_credentials_set_session_ticket_key_type grpc_ssl_server_credentials_set_session_ticket_key_import;
+#define grpc_ssl_server_credentials_set_session_ticket_key grpc_ssl_server_credentials_set_session_ticket_key_import
 typedef int(*grpc_server_add_secure_http2_port_type)(grpc_server* server, const char* addr, grpc_server_credentials* creds);
 extern grpc_server_add_secure_http2_port_type grpc_server_add_secure_http2_port_import;
 #define grpc_server_add_secure_http2_port grpc_server_add_secure_http2_port_import
@@ -506,6 +515,9 @@ extern grpc_byte_buffer_reader_next_type grpc_byte_buffer_reader_next_import;
 typedef int(*grpc_byte_buffer_reader_peek_type)(grpc_byte_buffer_reader* reader, grpc_slice** slice);
 extern grpc_byte_buffer_reader_peek_type grpc_byte_buffer_reader_peek_import;
 #define grpc_byte_buffer_reader_peek grpc_byte_buffer_reader_peek_import
+typedef int(*grpc_byte_buffer_reader_peek_all_type)(grpc_byte_buffer_reader* reader, grpc_slice** slices, size_t* slice_count);
+extern grpc_byte_buffer_reader_peek_all_type grpc_byte_buffer_reader_peek_all_import;
+#define grpc_byte_buffer_reader_peek_all grpc_byte_buffer_reader_peek_all_import
 typedef grpc_slice(*grpc_byte_buffer_reader_readall_type)(grpc_byte_buffer_reader* reader);
 extern grpc_byte_buffer_reader_readall_type grpc_byte_buffer_reader_readall_import;
 #define grpc_byte_buffer_reader_readall grpc_byte_buffer_reader_readall_import
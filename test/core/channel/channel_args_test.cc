@@ -53,6 +53,31 @@ static void test_create(void) {
   grpc_channel_args_destroy(ch_args);
 }
 
+static void test_hash(void) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_arg to_add[2];
+  to_add[0] =
+      grpc_channel_arg_integer_create(const_cast<char*>("int_arg"), 123);
+  to_add[1] = grpc_channel_arg_string_create(const_cast<char*>("str key"),
+                                             const_cast<char*>("str value"));
+  grpc_channel_args* a = grpc_channel_args_copy_and_add(nullptr, to_add, 2);
+  grpc_channel_args* b = grpc_channel_args_copy(a);
+
+  /* equal args hash equal */
+  GPR_ASSERT(grpc_channel_args_compare(a, b) == 0);
+  GPR_ASSERT(grpc_channel_args_hash(a) == grpc_channel_args_hash(b));
+
+  /* a changed value changes the hash */
+  to_add[0] =
+      grpc_channel_arg_integer_create(const_cast<char*>("int_arg"), 124);
+  grpc_channel_args* c = grpc_channel_args_copy_and_add(nullptr, to_add, 2);
+  GPR_ASSERT(grpc_channel_args_hash(a) != grpc_channel_args_hash(c));
+
+  grpc_channel_args_destroy(a);
+  grpc_channel_args_destroy(b);
+  grpc_channel_args_destroy(c);
+}
+
 struct fake_class {
   int foo;
 };
@@ -203,6 +228,7 @@ int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_create();
+  test_hash();
   test_channel_create_with_args();
   test_server_create_with_args();
   // This has to be the last test.
@@ -166,6 +166,43 @@ static void test_tiny_data_compress(void) {
   grpc_slice_buffer_destroy(&output);
 }
 
+static void test_compression_context_reuse(void) {
+  grpc_msg_compression_context ctx = {nullptr, 0};
+
+  for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (i == GRPC_MESSAGE_COMPRESS_NONE) continue;
+    const grpc_message_compression_algorithm algorithm =
+        static_cast<grpc_message_compression_algorithm>(i);
+    /* compress several messages through one context: each must remain
+       independently decompressable and byte-identical to a context-free
+       compression of the same payload */
+    for (int msg = 0; msg < 3; msg++) {
+      grpc_core::ExecCtx exec_ctx;
+      grpc_slice_buffer input;
+      grpc_slice_buffer with_ctx;
+      grpc_slice_buffer without_ctx;
+      grpc_slice_buffer decompressed;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&with_ctx);
+      grpc_slice_buffer_init(&without_ctx);
+      grpc_slice_buffer_init(&decompressed);
+      grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+      GPR_ASSERT(1 == grpc_msg_compress_ctx(&ctx, algorithm, &input,
+                                            &with_ctx));
+      GPR_ASSERT(1 == grpc_msg_compress(algorithm, &input, &without_ctx));
+      GPR_ASSERT(with_ctx.length == without_ctx.length);
+      GPR_ASSERT(1 == grpc_msg_decompress(algorithm, &with_ctx,
+                                          &decompressed));
+      GPR_ASSERT(decompressed.length == input.length);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&with_ctx);
+      grpc_slice_buffer_destroy(&without_ctx);
+      grpc_slice_buffer_destroy(&decompressed);
+    }
+  }
+  grpc_msg_compression_context_destroy(&ctx);
+}
+
 static void test_bad_decompression_data_crc(void) {
   grpc_slice_buffer input;
   grpc_slice_buffer corrupted;
@@ -314,6 +351,7 @@ int main(int argc, char** argv) {
   }
 
   test_tiny_data_compress();
+  test_compression_context_reuse();
   test_bad_decompression_data_crc();
   test_bad_decompression_data_stream();
   test_bad_decompression_data_trailing_garbage();
@@ -35,6 +35,23 @@ using grpc_core::Arena;
 
 static void test_noop(void) { Arena::Create(1)->Destroy(); }
 
+static void test_reset(void) {
+  auto arena_with_alloc = Arena::CreateWithAlloc(256, 64);
+  Arena* a = arena_with_alloc.first;
+  void* first = arena_with_alloc.second;
+  GPR_ASSERT(a->initial_zone_size() == 256);
+  GPR_ASSERT(a->TotalUsed() == 64);
+  GPR_ASSERT(!a->HasOverflowZones());
+  memset(a->Alloc(64), 1, 64);
+  /* a reset arena behaves like a freshly created one: same initial
+     allocation pointer, usage rewound */
+  void* reset_alloc = a->Reset(64);
+  GPR_ASSERT(reset_alloc == first);
+  GPR_ASSERT(a->TotalUsed() == 64);
+  memset(a->Alloc(64), 1, 64);
+  GPR_ASSERT(a->Destroy() > 0);
+}
+
 static void test(const char* name, size_t init_size, const size_t* allocs,
                  size_t nallocs) {
   gpr_strvec v;
@@ -121,6 +138,7 @@ int main(int argc, char* argv[]) {
   grpc::testing::TestEnvironment env(argc, argv);
 
   test_noop();
+  test_reset();
   TEST(0_1, 0, 1);
   TEST(1_1, 1, 1);
   TEST(1_2, 1, 2);
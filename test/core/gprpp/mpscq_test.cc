@@ -58,6 +58,30 @@ static void test_serial(void) {
   }
 }
 
+static void test_drain_all(void) {
+  gpr_log(GPR_DEBUG, "test_drain_all");
+  MultiProducerSingleConsumerQueue q;
+  GPR_ASSERT(q.DrainAll() == nullptr);
+  for (size_t i = 0; i < 10000; i++) {
+    q.Push(&new_node(i, nullptr)->node);
+  }
+  MultiProducerSingleConsumerQueue::Node* n = q.DrainAll();
+  for (size_t i = 0; i < 10000; i++) {
+    GPR_ASSERT(n);
+    test_node* tn = reinterpret_cast<test_node*>(n);
+    GPR_ASSERT(tn->i == i);
+    n = n->next.Load(grpc_core::MemoryOrder::RELAXED);
+    gpr_free(tn);
+  }
+  GPR_ASSERT(n == nullptr);
+  GPR_ASSERT(q.Pop() == nullptr);
+  // the queue is usable again after a drain
+  q.Push(&new_node(42, nullptr)->node);
+  test_node* tn = reinterpret_cast<test_node*>(q.Pop());
+  GPR_ASSERT(tn && tn->i == 42);
+  gpr_free(tn);
+}
+
 typedef struct {
   size_t ctr;
   MultiProducerSingleConsumerQueue* q;
@@ -108,6 +132,43 @@ static void test_mt(void) {
   }
 }
 
+static void test_mt_drain(void) {
+  gpr_log(GPR_DEBUG, "test_mt_drain");
+  gpr_event start;
+  gpr_event_init(&start);
+  grpc_core::Thread thds[100];
+  thd_args ta[GPR_ARRAY_SIZE(thds)];
+  MultiProducerSingleConsumerQueue q;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(thds); i++) {
+    ta[i].ctr = 0;
+    ta[i].q = &q;
+    ta[i].start = &start;
+    thds[i] = grpc_core::Thread("grpc_mt_drain_test", test_thread, &ta[i]);
+    thds[i].Start();
+  }
+  size_t num_done = 0;
+  size_t batches = 0;
+  gpr_event_set(&start, (void*)1);
+  while (num_done != GPR_ARRAY_SIZE(thds)) {
+    MultiProducerSingleConsumerQueue::Node* n;
+    while ((n = q.DrainAll()) == nullptr) {
+    }
+    batches++;
+    while (n != nullptr) {
+      test_node* tn = reinterpret_cast<test_node*>(n);
+      n = n->next.Load(grpc_core::MemoryOrder::RELAXED);
+      GPR_ASSERT(*tn->ctr == tn->i - 1);
+      *tn->ctr = tn->i;
+      if (tn->i == THREAD_ITERATIONS) num_done++;
+      gpr_free(tn);
+    }
+  }
+  gpr_log(GPR_DEBUG, "batches: %" PRIdPTR, batches);
+  for (auto& th : thds) {
+    th.Join();
+  }
+}
+
 typedef struct {
   thd_args* ta;
   size_t num_thds;
@@ -182,7 +243,9 @@ static void test_mt_multipop(void) {
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   test_serial();
+  test_drain_all();
   test_mt();
+  test_mt_drain();
   test_mt_multipop();
   return 0;
 }
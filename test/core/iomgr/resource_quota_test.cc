@@ -317,6 +317,56 @@ static void test_blocked_until_scheduled_reclaim(void) {
   destroy_user(usr);
 }
 
+static void trim_cb(void* arg) {
+  gpr_event_set(static_cast<gpr_event*>(arg), (void*)1);
+}
+
+static void test_trim_callback_on_exhaustion(void) {
+  gpr_log(GPR_INFO, "** test_trim_callback_on_exhaustion **");
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_trim_callback_on_exhaustion");
+  grpc_resource_quota_resize(q, 1024);
+  gpr_event trim_called;
+  gpr_event_init(&trim_called);
+  grpc_resource_quota_set_trim_callback(q, trim_cb, &trim_called);
+  grpc_resource_user* usr = grpc_resource_user_create(q, "usr");
+  {
+    gpr_event ev;
+    gpr_event_init(&ev);
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(!grpc_resource_user_alloc(usr, 1024, set_event(&ev)));
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+               nullptr);
+  }
+  gpr_event ev;
+  gpr_event_init(&ev);
+  {
+    grpc_core::ExecCtx exec_ctx;
+    /* block a 512-byte alloc: freeing the 1024 below must leave the free
+       pool strictly positive, since the quota only reschedules its step on
+       a negative-to-positive transition */
+    GPR_ASSERT(!grpc_resource_user_alloc(usr, 512, set_event(&ev)));
+    grpc_core::ExecCtx::Get()->Flush();
+    /* no reclaimers are registered, so exhaustion must reach the trimmer */
+    GPR_ASSERT(gpr_event_wait(&trim_called,
+                              grpc_timeout_seconds_to_deadline(5)) != nullptr);
+    /* ... but trimming by itself frees nothing: the alloc stays blocked */
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_milliseconds_to_deadline(
+                                       100)) == nullptr);
+  }
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_free(usr, 1024);
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+               nullptr);
+    grpc_resource_user_free(usr, 512);
+  }
+  grpc_resource_quota_unref(q);
+  destroy_user(usr);
+}
+
 static void test_blocked_until_scheduled_reclaim_and_scavenge(void) {
   gpr_log(GPR_INFO, "** test_blocked_until_scheduled_reclaim_and_scavenge **");
   grpc_resource_quota* q = grpc_resource_quota_create(
@@ -905,6 +955,7 @@ int main(int argc, char** argv) {
   test_scavenge();
   test_scavenge_blocked();
   test_blocked_until_scheduled_reclaim();
+  test_trim_callback_on_exhaustion();
   test_blocked_until_scheduled_reclaim_and_scavenge();
   test_blocked_until_scheduled_destructive_reclaim();
   test_unused_reclaim_is_cancelled();
@@ -52,13 +52,13 @@ static int contains(grpc_timer_heap* pq, grpc_timer* el) {
 static void check_valid(grpc_timer_heap* pq) {
   size_t i;
   for (i = 0; i < pq->timer_count; ++i) {
-    size_t left_child = 1u + 2u * i;
-    size_t right_child = left_child + 1u;
-    if (left_child < pq->timer_count) {
-      GPR_ASSERT(pq->timers[i]->deadline <= pq->timers[left_child]->deadline);
-    }
-    if (right_child < pq->timer_count) {
-      GPR_ASSERT(pq->timers[i]->deadline <= pq->timers[right_child]->deadline);
+    /* the mirrored deadline array must stay in sync */
+    GPR_ASSERT(pq->deadlines[i] == pq->timers[i]->deadline);
+    /* 4-ary heap property */
+    for (size_t child = 4u * i + 1u; child <= 4u * i + 4u; ++child) {
+      if (child < pq->timer_count) {
+        GPR_ASSERT(pq->timers[i]->deadline <= pq->timers[child]->deadline);
+      }
     }
   }
 }
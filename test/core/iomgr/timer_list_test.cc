@@ -21,6 +21,7 @@
 // This test only works with the generic timer implementation
 #ifndef GRPC_CUSTOM_SOCKET
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
 #include "src/core/lib/iomgr/timer.h"
 
@@ -109,6 +110,52 @@ static void add_test(void) {
   grpc_timer_list_shutdown();
 }
 
+/* Batch-cancelling a mix of pending and already-fired timers. */
+static void cancel_batch_test(void) {
+  int i;
+  grpc_timer timers[20];
+  grpc_timer* to_cancel[20];
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "cancel_batch_test");
+
+  grpc_timer_list_init();
+  grpc_core::testing::grpc_tracer_enable_flag(&grpc_timer_trace);
+  grpc_core::testing::grpc_tracer_enable_flag(&grpc_timer_check_trace);
+  memset(cb_called, 0, sizeof(cb_called));
+
+  grpc_millis start = grpc_core::ExecCtx::Get()->Now();
+
+  /* timers 0..9 will fire before the batch cancel; 10..19 are cancelled
+     while still pending */
+  for (i = 0; i < 10; i++) {
+    grpc_timer_init(
+        &timers[i], start + 10,
+        GRPC_CLOSURE_CREATE(cb, (void*)(intptr_t)i, grpc_schedule_on_exec_ctx));
+  }
+  for (i = 10; i < 20; i++) {
+    grpc_timer_init(
+        &timers[i], start + 1010,
+        GRPC_CLOSURE_CREATE(cb, (void*)(intptr_t)i, grpc_schedule_on_exec_ctx));
+  }
+
+  grpc_core::ExecCtx::Get()->TestOnlySetNow(start + 500);
+  GPR_ASSERT(grpc_timer_check(nullptr) == GRPC_TIMERS_FIRED);
+  grpc_core::ExecCtx::Get()->Flush();
+
+  for (i = 0; i < 20; i++) {
+    to_cancel[i] = &timers[i];
+  }
+  grpc_timer_cancel_batch(to_cancel, 20);
+  grpc_core::ExecCtx::Get()->Flush();
+  for (i = 0; i < 20; i++) {
+    GPR_ASSERT(cb_called[i][1] == (i < 10));  /* fired before the cancel */
+    GPR_ASSERT(cb_called[i][0] == (i >= 10)); /* cancelled while pending */
+  }
+
+  grpc_timer_list_shutdown();
+}
+
 /* Cleaning up a list with pending timers. */
 void destruction_test(void) {
   grpc_timer timers[5];
@@ -224,12 +271,17 @@ int main(int argc, char** argv) {
     grpc::testing::TestEnvironment env(argc, argv);
     grpc_core::ExecCtx::GlobalInit();
     grpc_core::ExecCtx exec_ctx;
+    /* stats are incremented on timer-check paths and are normally set up by
+       grpc_init(), which this test deliberately bypasses */
+    grpc_stats_init();
     grpc_determine_iomgr_platform();
     grpc_iomgr_platform_init();
     gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
     add_test();
+    cancel_batch_test();
     destruction_test();
     grpc_iomgr_platform_shutdown();
+    grpc_stats_shutdown();
   }
   grpc_core::ExecCtx::GlobalShutdown();
 
@@ -245,13 +297,16 @@ int main(int argc, char** argv) {
                                          gpr_clock_type::GPR_CLOCK_MONOTONIC));
     grpc_core::ExecCtx::TestOnlyGlobalInit(new_start);
     grpc_core::ExecCtx exec_ctx;
+    grpc_stats_init();
     grpc_determine_iomgr_platform();
     grpc_iomgr_platform_init();
     gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
     long_running_service_cleanup_test();
     add_test();
+    cancel_batch_test();
     destruction_test();
     grpc_iomgr_platform_shutdown();
+    grpc_stats_shutdown();
   }
   grpc_core::ExecCtx::GlobalShutdown();
 
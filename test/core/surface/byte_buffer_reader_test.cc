@@ -123,6 +123,41 @@ static void test_peek_one_slice(void) {
   grpc_byte_buffer_destroy(buffer);
 }
 
+static void test_peek_all(void) {
+  grpc_slice slices[2];
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice* view;
+  size_t view_count;
+  grpc_slice* first_slice;
+
+  LOG_TEST("test_peek_all");
+  /* refcounted slices larger than GRPC_SLICE_INLINED_SIZE, so that
+     grpc_raw_byte_buffer_create cannot coalesce them into one slice */
+  slices[0] = grpc_slice_malloc(64);
+  memset(GRPC_SLICE_START_PTR(slices[0]), 'a', 64);
+  slices[1] = grpc_slice_malloc(64);
+  memset(GRPC_SLICE_START_PTR(slices[1]), 'b', 64);
+  buffer = grpc_raw_byte_buffer_create(slices, 2);
+  grpc_slice_unref(slices[0]);
+  grpc_slice_unref(slices[1]);
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  /* a prior peek consumes one slice; peek_all returns the remainder */
+  GPR_ASSERT(grpc_byte_buffer_reader_peek(&reader, &first_slice) != 0);
+  GPR_ASSERT(grpc_byte_buffer_reader_peek_all(&reader, &view, &view_count) !=
+             0);
+  GPR_ASSERT(view_count == 1);
+  GPR_ASSERT(GRPC_SLICE_LENGTH(view[0]) == 64);
+  GPR_ASSERT(GRPC_SLICE_START_PTR(view[0])[0] == 'b');
+  /* the reader is now fully consumed */
+  GPR_ASSERT(grpc_byte_buffer_reader_peek(&reader, &first_slice) == 0);
+  GPR_ASSERT(grpc_byte_buffer_reader_peek_all(&reader, &view, &view_count) !=
+             0);
+  GPR_ASSERT(view_count == 0);
+  grpc_byte_buffer_destroy(buffer);
+}
+
 static void test_peek_one_slice_malloc(void) {
   grpc_slice slice;
   grpc_byte_buffer* buffer;
@@ -339,6 +374,7 @@ int main(int argc, char** argv) {
   test_read_one_slice_malloc();
   test_read_none_compressed_slice();
   test_peek_one_slice();
+  test_peek_all();
   test_peek_one_slice_malloc();
   test_peek_none_compressed_slice();
   test_read_gzip_compressed_slice();
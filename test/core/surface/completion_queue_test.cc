@@ -165,6 +165,108 @@ static void test_cq_end_op(void) {
   }
 }
 
+static void test_pollset_sharing(void) {
+  grpc_event ev;
+  grpc_cq_completion completion;
+  grpc_completion_queue_attributes attr;
+  void* tag = create_test_tag();
+
+  LOG_TEST("test_pollset_sharing");
+
+  grpc_completion_queue* donor = grpc_completion_queue_create_for_next(nullptr);
+  attr.version = 3;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  attr.cq_polling_type = GRPC_CQ_DEFAULT_POLLING;
+  attr.cq_shutdown_cb = nullptr;
+  attr.cq_shared_pollset_donor = donor;
+  grpc_completion_queue* borrower = grpc_completion_queue_create(
+      grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+  /* the borrower polls the donor's pollset... */
+  GPR_ASSERT(grpc_cq_pollset(borrower) == grpc_cq_pollset(donor));
+
+  /* ...but keeps an independent event queue */
+  {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_cq_begin_op(borrower, tag));
+    grpc_cq_end_op(borrower, tag, GRPC_ERROR_NONE, do_nothing_end_completion,
+                   nullptr, &completion);
+    ev = grpc_completion_queue_next(borrower, gpr_inf_past(GPR_CLOCK_REALTIME),
+                                    nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    GPR_ASSERT(ev.tag == tag);
+    ev = grpc_completion_queue_next(donor, gpr_inf_past(GPR_CLOCK_REALTIME),
+                                    nullptr);
+    GPR_ASSERT(ev.type == GRPC_QUEUE_TIMEOUT);
+  }
+
+  /* borrowers shut down before the donor */
+  shutdown_and_destroy(borrower);
+  shutdown_and_destroy(donor);
+}
+
+static void test_cq_next_batch(void) {
+  grpc_event events[10];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[5];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+  void* tags[5];
+
+  LOG_TEST("test_cq_next_batch");
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      tags[j] = create_test_tag();
+      GPR_ASSERT(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], GRPC_ERROR_NONE, do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    /* all five events should come back in one call */
+    size_t n = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(n == GPR_ARRAY_SIZE(tags));
+    for (size_t j = 0; j < n; j++) {
+      GPR_ASSERT(events[j].type == GRPC_OP_COMPLETE);
+      GPR_ASSERT(events[j].tag == tags[j]);
+      GPR_ASSERT(events[j].success);
+    }
+
+    /* empty queue: a single timeout event */
+    n = grpc_completion_queue_next_batch(cc, events, GPR_ARRAY_SIZE(events),
+                                         gpr_inf_past(GPR_CLOCK_REALTIME),
+                                         nullptr);
+    GPR_ASSERT(n == 1);
+    GPR_ASSERT(events[0].type == GRPC_QUEUE_TIMEOUT);
+
+    /* a partial batch is bounded by max_events */
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      GPR_ASSERT(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], GRPC_ERROR_NONE, do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+    n = grpc_completion_queue_next_batch(
+        cc, events, 2, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr);
+    GPR_ASSERT(n == 2);
+    n = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    GPR_ASSERT(n == 3);
+
+    shutdown_and_destroy(cc);
+  }
+}
+
 static void test_cq_tls_cache_full(void) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -488,10 +590,12 @@ int main(int argc, char** argv) {
   grpc_init();
   test_no_op();
   test_pollset_conversion();
+  test_pollset_sharing();
   test_wait_empty();
   test_shutdown_then_next_polling();
   test_shutdown_then_next_with_timeout();
   test_cq_end_op();
+  test_cq_next_batch();
   test_pluck();
   test_pluck_after_shutdown();
   test_cq_tls_cache_full();
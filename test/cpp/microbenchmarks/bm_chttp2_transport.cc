@@ -490,6 +490,145 @@ static void BM_TransportStreamSend(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportStreamSend)->Range(0, 128 * 1024 * 1024);
 
+// Drives many concurrent streams over the fake endpoint, each stream
+// chaining its next send off the previous completion, so the
+// writable/writing stream lists carry state.range(0) entries through every
+// write cycle. Message sizes are mixed (1x/2x/4x of state.range(1), by
+// stream index) so the data path cannot settle into a single-size groove.
+// Per-iteration cost is one message on one stream: anything in stream list
+// or scheduler handling that scales with the number of active streams shows
+// up directly as time-per-op growth along the stream-count axis, which the
+// single-stream benchmarks above cannot see.
+static void BM_TransportStreamSendMultiStream(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  const size_t num_streams = static_cast<size_t>(state.range(0));
+  const size_t base_size = static_cast<size_t>(state.range(1));
+  Fixture f(grpc::ChannelArguments(), true);
+  std::vector<Stream*> streams(num_streams);
+  std::vector<std::unique_ptr<grpc_transport_stream_op_batch_payload>>
+      payloads;
+  std::vector<grpc_transport_stream_op_batch> ops(num_streams);
+  std::vector<std::unique_ptr<Closure>> closures(num_streams);
+  std::vector<grpc_metadata_batch> batches(num_streams);
+  std::vector<std::vector<grpc_linked_mdelem>> storage(num_streams);
+  std::vector<grpc_core::ManualConstructor<grpc_core::SliceBufferByteStream>>
+      send_streams(num_streams);
+  std::vector<grpc_mdelem> elems =
+      RepresentativeClientInitialMetadata::GetElems();
+  // three message sizes, assigned to streams round-robin
+  grpc_slice send_slices[3];
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(send_slices); i++) {
+    send_slices[i] = grpc_slice_malloc_large(base_size << i);
+    memset(GRPC_SLICE_START_PTR(send_slices[i]), 0,
+           GRPC_SLICE_LENGTH(send_slices[i]));
+  }
+  for (size_t i = 0; i < num_streams; i++) {
+    payloads.emplace_back(
+        new grpc_transport_stream_op_batch_payload(nullptr));
+    streams[i] = new Stream(&f);
+    streams[i]->Init(state);
+    grpc_metadata_batch_init(&batches[i]);
+    batches[i].deadline = GRPC_MILLIS_INF_FUTURE;
+    storage[i].resize(elems.size());
+    for (size_t j = 0; j < elems.size(); j++) {
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "addmd", grpc_metadata_batch_add_tail(&batches[i], &storage[i][j],
+                                                GRPC_MDELEM_REF(elems[j]))));
+    }
+  }
+  // each batch above took its own ref; drop the ones GetElems returned
+  for (size_t j = 0; j < elems.size(); j++) {
+    GRPC_MDELEM_UNREF(elems[j]);
+  }
+
+  gpr_event* bm_done = new gpr_event;
+  gpr_event_init(bm_done);
+  size_t streams_remaining = num_streams;
+
+  auto start_send = [&](size_t idx) {
+    grpc_slice_buffer send_buffer;
+    grpc_slice_buffer_init(&send_buffer);
+    grpc_slice_buffer_add(
+        &send_buffer,
+        grpc_slice_ref(send_slices[idx % GPR_ARRAY_SIZE(send_slices)]));
+    send_streams[idx].Init(&send_buffer, 0);
+    grpc_slice_buffer_destroy(&send_buffer);
+    // force outgoing window to be yuge
+    streams[idx]->chttp2_stream()->flow_control->TestOnlyForceHugeWindow();
+    f.chttp2_transport()->flow_control->TestOnlyForceHugeWindow();
+    ops[idx] = {};
+    ops[idx].payload = payloads[idx].get();
+    ops[idx].on_complete = closures[idx].get();
+    ops[idx].send_message = true;
+    payloads[idx]->send_message.send_message.reset(send_streams[idx].get());
+    streams[idx]->Op(&ops[idx]);
+  };
+
+  for (size_t i = 0; i < num_streams; i++) {
+    closures[i] = MakeClosure([&, i](grpc_error* /*error*/) {
+      if (!state.KeepRunning()) {
+        if (--streams_remaining == 0) {
+          gpr_event_set(bm_done, (void*)(1));
+        }
+        return;
+      }
+      start_send(i);
+    });
+  }
+
+  // kick every stream off with its initial metadata; each completion chains
+  // the stream's first message send
+  for (size_t i = 0; i < num_streams; i++) {
+    ops[i] = {};
+    ops[i].payload = payloads[i].get();
+    ops[i].send_initial_metadata = true;
+    payloads[i]->send_initial_metadata.send_initial_metadata = &batches[i];
+    ops[i].on_complete = closures[i].get();
+    streams[i]->Op(&ops[i]);
+  }
+
+  f.FlushExecCtx();
+  gpr_event_wait(bm_done, gpr_inf_future(GPR_CLOCK_REALTIME));
+  done_events.emplace_back(bm_done);
+
+  for (size_t i = 0; i < num_streams; i++) {
+    ops[i] = {};
+    ops[i].payload = payloads[i].get();
+    ops[i].cancel_stream = true;
+    payloads[i]->cancel_stream.cancel_error = GRPC_ERROR_CANCELLED;
+    gpr_event* stream_cancel_done = new gpr_event;
+    gpr_event_init(stream_cancel_done);
+    std::unique_ptr<Closure> stream_cancel_closure =
+        MakeClosure([stream_cancel_done](grpc_error* error) {
+          GPR_ASSERT(error == GRPC_ERROR_NONE);
+          gpr_event_set(stream_cancel_done, (void*)(1));
+        });
+    ops[i].on_complete = stream_cancel_closure.get();
+    streams[i]->Op(&ops[i]);
+    f.FlushExecCtx();
+    gpr_event_wait(stream_cancel_done, gpr_inf_future(GPR_CLOCK_REALTIME));
+    done_events.emplace_back(stream_cancel_done);
+    Stream* stream = streams[i];
+    stream->DestroyThen(
+        MakeOnceClosure([stream](grpc_error* /*error*/) { delete stream; }));
+    f.FlushExecCtx();
+    grpc_metadata_batch_destroy(&batches[i]);
+  }
+  track_counters.Finish(state);
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(send_slices); i++) {
+    grpc_slice_unref(send_slices[i]);
+  }
+}
+BENCHMARK(BM_TransportStreamSendMultiStream)
+    ->Args({1, 1024})
+    ->Args({16, 1024})
+    ->Args({64, 1024})
+    ->Args({256, 1024})
+    ->Args({512, 1024})
+    ->Args({64, 64 * 1024})
+    ->Args({256, 64 * 1024});
+
 #define SLICE_FROM_BUFFER(s) grpc_slice_from_static_buffer(s, sizeof(s) - 1)
 
 static grpc_slice CreateIncomingDataSlice(size_t length, size_t frame_size) {
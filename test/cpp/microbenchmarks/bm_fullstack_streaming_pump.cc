@@ -58,6 +58,19 @@ BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinUDS)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinInProcess)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinSockPair)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinInProcessCHTTP2)->Arg(0);
+// Saturation matrix: {concurrent streams} x {message size}
+BENCHMARK_TEMPLATE(BM_PumpConcurrentStreams, TCP)
+    ->Args({1, 4096})
+    ->Args({8, 4096})
+    ->Args({64, 4096})
+    ->Args({256, 4096})
+    ->Args({64, 0})
+    ->Args({64, 65536});
+BENCHMARK_TEMPLATE(BM_PumpConcurrentStreams, InProcessCHTTP2)
+    ->Args({1, 4096})
+    ->Args({8, 4096})
+    ->Args({64, 4096})
+    ->Args({256, 4096});
 
 }  // namespace testing
 }  // namespace grpc
@@ -37,6 +37,56 @@ static void BM_SliceFromStatic(benchmark::State& state) {
 }
 BENCHMARK(BM_SliceFromStatic);
 
+/* Build a heap slice of the given length filled with a repeating pattern */
+static grpc_slice MakePatternedSlice(size_t length) {
+  grpc_slice s = grpc_slice_malloc(length);
+  for (size_t i = 0; i < length; i++) {
+    GRPC_SLICE_START_PTR(s)[i] = static_cast<uint8_t>('a' + (i % 26));
+  }
+  return s;
+}
+
+/* Measures equality comparison of equal-sized, equal-content slices at
+   typical header value lengths (16-128 bytes; the arg is the length) */
+static void BM_SliceEqual(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice a = MakePatternedSlice(static_cast<size_t>(state.range(0)));
+  grpc_slice b = grpc_slice_copy(a);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_slice_eq(a, b));
+  }
+  grpc_slice_unref(a);
+  grpc_slice_unref(b);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceEqual)->Arg(16)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_SliceCmp(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice a = MakePatternedSlice(static_cast<size_t>(state.range(0)));
+  grpc_slice b = grpc_slice_copy(a);
+  /* differ in the last byte so the comparison must scan the whole value */
+  GRPC_SLICE_START_PTR(b)[GRPC_SLICE_LENGTH(b) - 1] ^= 1;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_slice_cmp(a, b));
+  }
+  grpc_slice_unref(a);
+  grpc_slice_unref(b);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceCmp)->Arg(16)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_SliceHash(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice a = MakePatternedSlice(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_slice_hash_internal(a));
+  }
+  grpc_slice_unref(a);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceHash)->Arg(16)->Arg(32)->Arg(64)->Arg(128);
+
 static void BM_SliceFromCopied(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
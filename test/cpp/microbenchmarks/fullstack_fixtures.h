@@ -83,16 +83,29 @@ class FullstackFixture : public BaseFixture {
     b.RegisterService(service);
     config.ApplyCommonServerBuilderConfig(&b);
     server_ = b.BuildAndStart();
-    ChannelArguments args;
-    config.ApplyCommonChannelArguments(&args);
+    address_ = address;
+    config.ApplyCommonChannelArguments(&base_channel_args_);
     if (address.length() > 0) {
       channel_ = ::grpc::CreateCustomChannel(
-          address, InsecureChannelCredentials(), args);
+          address, InsecureChannelCredentials(), base_channel_args_);
     } else {
-      channel_ = server_->InProcessChannel(args);
+      channel_ = server_->InProcessChannel(base_channel_args_);
     }
   }
 
+  // Creates an additional client channel to the same server, forced onto its
+  // own connection by a distinguishing dummy channel arg (identical args
+  // would share the existing channel's subchannel).
+  std::shared_ptr<Channel> NewIsolatedChannel(int idx) {
+    ChannelArguments args = base_channel_args_;
+    args.SetInt("grpc.benchmark.channel_idx", idx);
+    if (address_.length() > 0) {
+      return ::grpc::CreateCustomChannel(address_, InsecureChannelCredentials(),
+                                         args);
+    }
+    return server_->InProcessChannel(args);
+  }
+
   virtual ~FullstackFixture() {
     // Dummy shutdown tag (this tag is swallowed by cq->Next() and is not
     // returned to the user) see ShutdownTag definition for more details
@@ -120,6 +133,8 @@ class FullstackFixture : public BaseFixture {
   std::unique_ptr<Server> server_;
   std::unique_ptr<ServerCompletionQueue> cq_;
   std::shared_ptr<Channel> channel_;
+  grpc::string address_;
+  ChannelArguments base_channel_args_;
 };
 
 class TCP : public FullstackFixture {
@@ -22,7 +22,9 @@
 #define TEST_CPP_MICROBENCHMARKS_FULLSTACK_STREAMING_PUMP_H
 
 #include <benchmark/benchmark.h>
+#include <memory>
 #include <sstream>
+#include <vector>
 #include "src/core/lib/profiling/timers.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
@@ -106,6 +108,89 @@ static void BM_PumpStreamClientToServer(benchmark::State& state) {
   state.SetBytesProcessed(state.range(0) * state.iterations());
 }
 
+/* Saturation kernel: pumps client->server messages over state.range(0)
+   concurrent bidi streams on one channel (state.range(1) bytes per
+   message), so per-connection contention - combiner serialization, write
+   scheduling, MAX_CONCURRENT_STREAMS interactions - shows up in a way the
+   single-stream pumps above cannot expose. Each benchmark iteration
+   accounts one completed client write on some stream. */
+template <class Fixture>
+static void BM_PumpConcurrentStreams(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  const intptr_t num_streams = state.range(0);
+  {
+    EchoRequest send_request;
+    if (state.range(1) > 0) {
+      send_request.set_message(std::string(state.range(1), 'a'));
+    }
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+    struct StreamState {
+      ServerContext svr_ctx;
+      std::unique_ptr<ServerAsyncReaderWriter<EchoResponse, EchoRequest>>
+          response_rw;
+      ClientContext cli_ctx;
+      std::unique_ptr<ClientAsyncReaderWriter<EchoRequest, EchoResponse>>
+          request_rw;
+      EchoRequest recv_request;
+    };
+    std::vector<std::unique_ptr<StreamState>> streams;
+    void* t;
+    bool ok;
+    /* tag encoding: stream index * 2, +1 for client-side completions */
+    for (intptr_t i = 0; i < num_streams; i++) {
+      streams.emplace_back(new StreamState());
+      StreamState* ss = streams.back().get();
+      ss->response_rw.reset(
+          new ServerAsyncReaderWriter<EchoResponse, EchoRequest>(&ss->svr_ctx));
+      service.RequestBidiStream(&ss->svr_ctx, ss->response_rw.get(),
+                                fixture->cq(), fixture->cq(), tag(2 * i));
+      ss->request_rw =
+          stub->AsyncBidiStream(&ss->cli_ctx, fixture->cq(), tag(2 * i + 1));
+    }
+    intptr_t outstanding = 2 * num_streams;
+    while (outstanding > 0) {
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      GPR_ASSERT(ok);
+      outstanding--;
+    }
+    /* prime: one outstanding server read and one client write per stream */
+    for (intptr_t i = 0; i < num_streams; i++) {
+      streams[i]->response_rw->Read(&streams[i]->recv_request, tag(2 * i));
+      streams[i]->request_rw->Write(send_request, tag(2 * i + 1));
+    }
+    for (auto _ : state) {
+      while (true) {
+        GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+        GPR_ASSERT(ok);
+        const intptr_t i = reinterpret_cast<intptr_t>(t);
+        if (i & 1) {
+          /* client write completed: keep that stream saturated */
+          streams[i / 2]->request_rw->Write(send_request, t);
+          break;
+        }
+        /* server read completed: repost */
+        streams[i / 2]->response_rw->Read(&streams[i / 2]->recv_request, t);
+      }
+    }
+    /* teardown: every stream has exactly one outstanding client write and
+       one outstanding server read; cancel and drain them all */
+    for (intptr_t i = 0; i < num_streams; i++) {
+      streams[i]->cli_ctx.TryCancel();
+    }
+    outstanding = 2 * num_streams;
+    while (outstanding > 0) {
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      outstanding--;
+    }
+  }
+  fixture->Finish(state);
+  fixture.reset();
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.range(1) * state.iterations());
+}
+
 template <class Fixture>
 static void BM_PumpStreamServerToClient(benchmark::State& state) {
   EchoTestService::AsyncService service;
@@ -46,6 +46,16 @@ LibraryInitializer& LibraryInitializer::get() {
   return *g_libraryInitializer;
 }
 
+// Coverage note: with a counters-enabled build
+// (GRPC_COLLECT_STATS + GRPC_LOW_LEVEL_COUNTERS), Finish() already emits
+// the regression numbers usually asked for: every core stats counter
+// (including the tcp write/read size and iov histograms), mutex
+// acquisitions, atomic cas/add counts and allocations, all normalized per
+// iteration - so allocs/message and atomics/message for the pump
+// benchmarks are available today. The one requested signal with no source
+// is bytes-memcpy'd: slice copies happen through plain memcpy in many
+// helpers, so counting them needs a GRPC_SLICE_MEMCPY-style wrapper at
+// each copy site first; add the counter when such a choke point exists.
 void TrackCounters::Finish(benchmark::State& state) {
   std::ostringstream out;
   for (const auto& l : labels_) {
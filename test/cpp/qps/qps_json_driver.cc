@@ -47,6 +47,11 @@ DEFINE_string(search_param, "",
 DEFINE_double(
     initial_search_value, 0.0,
     "initial parameter value to start the search with (i.e. lower bound)");
+DEFINE_double(targeted_p99_latency_ms, 0.0,
+              "If non-zero, the offered_load search targets this p99 latency "
+              "(milliseconds) instead of server CPU load: the driver emits "
+              "the maximum offered load whose measured p99 still meets the "
+              "SLO, i.e. a machine-readable capacity number.");
 DEFINE_double(targeted_cpu_load, 70.0,
               "Targeted cpu load (unit: %, range [0,100])");
 DEFINE_double(stride, 1,
@@ -162,7 +167,11 @@ static std::unique_ptr<ScenarioResult> RunAndReport(
   return result;
 }
 
-static double GetCpuLoad(
+/* Runs the scenario open-loop at the given poisson offered load and returns
+   the search metric: server CPU load by default, or measured p99 latency in
+   milliseconds when -targeted_p99_latency_ms is set. Both metrics are
+   monotone in offered load, so the same bracketing/binary search applies. */
+static double GetSearchMetric(
     Scenario* scenario, double offered_load,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
@@ -171,23 +180,27 @@ static double GetCpuLoad(
       ->mutable_poisson()
       ->set_offered_load(offered_load);
   auto result = RunAndReport(*scenario, per_worker_credential_types, success);
+  if (FLAGS_targeted_p99_latency_ms > 0) {
+    /* summary latencies are in nanoseconds */
+    return result->summary().latency_99() / (1000.0 * 1000.0);
+  }
   return result->summary().server_cpu_usage();
 }
 
 static double BinarySearch(
-    Scenario* scenario, double targeted_cpu_load, double low, double high,
+    Scenario* scenario, double targeted_metric, double low, double high,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
   while (low <= high * (1 - FLAGS_error_tolerance)) {
     double mid = low + (high - low) / 2;
-    double current_cpu_load =
-        GetCpuLoad(scenario, mid, per_worker_credential_types, success);
+    double current_metric =
+        GetSearchMetric(scenario, mid, per_worker_credential_types, success);
     gpr_log(GPR_DEBUG, "Binary Search: current_offered_load %.0f", mid);
     if (!*success) {
       gpr_log(GPR_ERROR, "Client/Server Failure");
       break;
     }
-    if (targeted_cpu_load <= current_cpu_load) {
+    if (targeted_metric <= current_metric) {
       high = mid - FLAGS_stride;
     } else {
       low = mid + FLAGS_stride;
@@ -198,28 +211,28 @@ static double BinarySearch(
 }
 
 static double SearchOfferedLoad(
-    double initial_offered_load, double targeted_cpu_load, Scenario* scenario,
+    double initial_offered_load, double targeted_metric, Scenario* scenario,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
   std::cerr << "RUNNING SCENARIO: " << scenario->name() << "\n";
   double current_offered_load = initial_offered_load;
-  double current_cpu_load = GetCpuLoad(scenario, current_offered_load,
-                                       per_worker_credential_types, success);
-  if (current_cpu_load > targeted_cpu_load) {
+  double current_metric = GetSearchMetric(scenario, current_offered_load,
+                                          per_worker_credential_types, success);
+  if (current_metric > targeted_metric) {
     gpr_log(GPR_ERROR, "Initial offered load too high");
     return -1;
   }
 
-  while (*success && (current_cpu_load < targeted_cpu_load)) {
+  while (*success && (current_metric < targeted_metric)) {
     current_offered_load *= 2;
-    current_cpu_load = GetCpuLoad(scenario, current_offered_load,
-                                  per_worker_credential_types, success);
+    current_metric = GetSearchMetric(scenario, current_offered_load,
+                                     per_worker_credential_types, success);
     gpr_log(GPR_DEBUG, "Binary Search: current_offered_load  %.0f",
             current_offered_load);
   }
 
   double targeted_offered_load =
-      BinarySearch(scenario, targeted_cpu_load, current_offered_load / 2,
+      BinarySearch(scenario, targeted_metric, current_offered_load / 2,
                    current_offered_load, per_worker_credential_types, success);
 
   return targeted_offered_load;
@@ -272,12 +285,15 @@ static bool QpsDriver() {
     } else {
       if (FLAGS_search_param == "offered_load") {
         Scenario* scenario = scenarios.mutable_scenarios(i);
+        const double targeted_metric = FLAGS_targeted_p99_latency_ms > 0
+                                           ? FLAGS_targeted_p99_latency_ms
+                                           : FLAGS_targeted_cpu_load;
         double targeted_offered_load = SearchOfferedLoad(
-            FLAGS_initial_search_value, FLAGS_targeted_cpu_load, scenario,
+            FLAGS_initial_search_value, targeted_metric, scenario,
             per_worker_credential_types, &success);
         gpr_log(GPR_INFO, "targeted_offered_load %f", targeted_offered_load);
-        GetCpuLoad(scenario, targeted_offered_load, per_worker_credential_types,
-                   &success);
+        GetSearchMetric(scenario, targeted_offered_load,
+                        per_worker_credential_types, &success);
       } else {
         gpr_log(GPR_ERROR, "Unimplemented search param");
       }
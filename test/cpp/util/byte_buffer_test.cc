@@ -56,6 +56,46 @@ TEST_F(ByteBufferTest, CreateFromSingleSlice) {
   EXPECT_EQ(strlen(kContent1), buffer.Length());
 }
 
+TEST_F(ByteBufferTest, MoveCtorAndAssign) {
+  Slice s(kContent1);
+  ByteBuffer buffer(&s, 1);
+  ByteBuffer moved(std::move(buffer));
+  EXPECT_FALSE(buffer.Valid());
+  EXPECT_EQ(strlen(kContent1), moved.Length());
+  ByteBuffer assigned;
+  assigned = std::move(moved);
+  EXPECT_FALSE(moved.Valid());
+  EXPECT_EQ(strlen(kContent1), assigned.Length());
+}
+
+TEST_F(ByteBufferTest, CreateFromMovedSlice) {
+  Slice s(kContent1);
+  ByteBuffer buffer(std::move(s));
+  EXPECT_EQ(0u, s.size());
+  EXPECT_EQ(strlen(kContent1), buffer.Length());
+}
+
+TEST_F(ByteBufferTest, TrySingleSlice) {
+  Slice s(kContent1);
+  ByteBuffer buffer(&s, 1);
+  Slice borrowed;
+  EXPECT_TRUE(buffer.TrySingleSlice(&borrowed).ok());
+  EXPECT_EQ(strlen(kContent1), borrowed.size());
+  std::vector<Slice> two;
+  two.emplace_back(kContent1);
+  two.emplace_back(kContent2);
+  ByteBuffer multi(&two[0], 2);
+  EXPECT_FALSE(multi.TrySingleSlice(&borrowed).ok());
+}
+
+TEST_F(ByteBufferTest, SliceRelease) {
+  Slice s(kContent1);
+  grpc_slice released = s.release();
+  EXPECT_EQ(0u, s.size());
+  EXPECT_EQ(strlen(kContent1), GRPC_SLICE_LENGTH(released));
+  grpc_slice_unref(released);
+}
+
 TEST_F(ByteBufferTest, CreateFromVector) {
   std::vector<Slice> slices;
   slices.emplace_back(kContent1);
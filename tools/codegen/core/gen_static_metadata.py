@@ -629,6 +629,9 @@ def perfect_hash(keys, name):
         'PHASHNKEYS': len(p.slots),
         'pyfunc': f,
         'code': """
+/* Generated minimal perfect hash for the static metadata table: two
+   arithmetic ops, one displacement-table load and one key compare resolve
+   any static (key, value) pair with no collision probing. */
 static const int8_t %(name)s_r[] = {%(r)s};
 static uint32_t %(name)s_phash(uint32_t i) {
   i %(offset_sign)s= %(offset)d;